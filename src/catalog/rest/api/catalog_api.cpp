@@ -187,19 +187,25 @@ bool IRCAPI::VerifyTableExistence(ClientContext &context, IcebergCatalog &catalo
 }
 
 static unique_ptr<HTTPResponse> GetTableMetadata(ClientContext &context, IcebergCatalog &catalog,
-                                                 const IcebergSchemaEntry &schema, const string &table) {
+                                                 const vector<string> &namespace_items, const string &table,
+                                                 const string &etag, bool all_snapshots) {
 	auto url_builder = catalog.GetBaseUrl();
 	url_builder.AddPrefixComponents(catalog.prefix);
 	url_builder.AddPathComponent(IRCPathComponent::RegularComponent("namespaces"));
-	url_builder.AddPathComponent(
-	    IRCPathComponent::NamespaceComponent(schema.namespace_items, catalog.namespace_separator));
+	url_builder.AddPathComponent(IRCPathComponent::NamespaceComponent(namespace_items, catalog.namespace_separator));
 	url_builder.AddPathComponent(IRCPathComponent::RegularComponent("tables"));
 	url_builder.AddPathComponent(IRCPathComponent::RegularComponent(table));
+	if (!all_snapshots && catalog.attach_options.snapshot_loading_mode == IcebergSnapshotLoadingMode::REFS) {
+		url_builder.SetParam("snapshots", IRCPathComponent::RegularComponent("refs"));
+	}
 
 	HTTPHeaders headers(*context.db);
 	if (catalog.attach_options.access_mode == IRCAccessDelegationMode::VENDED_CREDENTIALS) {
 		headers.Insert("X-Iceberg-Access-Delegation", "vended-credentials");
 	}
+	if (!etag.empty()) {
+		headers.Insert("If-None-Match", etag);
+	}
 	return catalog.auth_handler->Request(RequestType::GET_REQUEST, context, url_builder, headers);
 }
 
@@ -221,12 +227,26 @@ static unique_ptr<HTTPResponse> LoadCredentials(ClientContext &context, IcebergC
 	return catalog.auth_handler->Request(RequestType::GET_REQUEST, context, url_builder, headers);
 }
 
-APIResult<unique_ptr<const rest_api_objects::LoadTableResult>> IRCAPI::GetTable(ClientContext &context,
-                                                                                IcebergCatalog &catalog,
-                                                                                const IcebergSchemaEntry &schema,
-                                                                                const string &table_name) {
+APIResult<unique_ptr<const rest_api_objects::LoadTableResult>>
+IRCAPI::GetTable(ClientContext &context, IcebergCatalog &catalog, const IcebergSchemaEntry &schema,
+                 const string &table_name, const string &etag, bool all_snapshots) {
+	return GetTable(context, catalog, schema.namespace_items, table_name, etag, all_snapshots);
+}
+
+APIResult<unique_ptr<const rest_api_objects::LoadTableResult>>
+IRCAPI::GetTable(ClientContext &context, IcebergCatalog &catalog, const vector<string> &namespace_items,
+                 const string &table_name, const string &etag, bool all_snapshots) {
 	auto ret = APIResult<unique_ptr<const rest_api_objects::LoadTableResult>>();
-	auto result = GetTableMetadata(context, catalog, schema, table_name);
+	auto result = GetTableMetadata(context, catalog, namespace_items, table_name, etag, all_snapshots);
+	if (result->headers.HasHeader("ETag")) {
+		ret.etag_ = result->headers.GetHeaderValue("ETag");
+	}
+	if (!etag.empty() && result->status == HTTPStatusCode::NotModified_304) {
+		//! The metadata the caller holds for 'etag' is still current
+		ret.status_ = result->status;
+		ret.etag_ = etag;
+		return ret;
+	}
 	if (result->status != HTTPStatusCode::OK_200) {
 		unique_ptr<JSONDocument> out_doc;
 		auto error_obj = ICUtils::GetErrorMessage(result->body, out_doc);
@@ -239,6 +259,7 @@ APIResult<unique_ptr<const rest_api_objects::LoadTableResult>> IRCAPI::GetTable(
 	}
 	auto doc = ICUtils::APIResultToDoc(result->body);
 	auto metadata_root = doc->GetRoot();
+	ret.status_ = result->status;
 	ret.result_ =
 	    make_uniq<const rest_api_objects::LoadTableResult>(rest_api_objects::LoadTableResult::FromJSON(metadata_root));
 	return ret;
@@ -362,7 +383,20 @@ optional<vector<rest_api_objects::TableIdentifier>> IRCAPI::GetTables(ClientCont
 	return all_identifiers;
 }
 
-vector<IRCAPISchema> IRCAPI::GetSchemas(ClientContext &context, IcebergCatalog &catalog, const vector<string> &parent) {
+vector<optional<vector<rest_api_objects::TableIdentifier>>>
+IRCAPI::GetTables(ClientContext &context, IcebergCatalog &catalog,
+                  const vector<reference<IcebergSchemaEntry>> &schemas) {
+	vector<optional<vector<rest_api_objects::TableIdentifier>>> result(schemas.size());
+	IcebergUtils::RunIndexedTasks(
+	    context, schemas.size(), [&](idx_t i) { result[i] = GetTables(context, catalog, schemas[i].get()); },
+	    MAX_CONCURRENT_REQUESTS);
+	return result;
+}
+
+namespace {
+
+//! List the direct children of 'parent', following the pagination. Empty if the catalog refused the listing.
+vector<IRCAPISchema> ListNamespaces(ClientContext &context, IcebergCatalog &catalog, const vector<string> &parent) {
 	vector<IRCAPISchema> result;
 	string page_token = "";
 	do {
@@ -405,15 +439,7 @@ vector<IRCAPISchema> IRCAPI::GetSchemas(ClientContext &context, IcebergCatalog &
 			IRCAPISchema schema_result;
 			schema_result.catalog_name = catalog.GetName().GetIdentifierName();
 			schema_result.items = std::move(schema.value);
-
-			if (catalog.attach_options.support_nested_namespaces) {
-				auto new_parent = parent;
-				new_parent.push_back(schema_result.items.back());
-				auto nested_namespaces = GetSchemas(context, catalog, new_parent);
-				result.insert(result.end(), std::make_move_iterator(nested_namespaces.begin()),
-				              std::make_move_iterator(nested_namespaces.end()));
-			}
-			result.push_back(schema_result);
+			result.push_back(std::move(schema_result));
 		}
 
 		if (list_namespaces_response.next_page_token) {
@@ -426,6 +452,44 @@ vector<IRCAPISchema> IRCAPI::GetSchemas(ClientContext &context, IcebergCatalog &
 	return result;
 }
 
+} // namespace
+
+IRCNamespaceCrawler::IRCNamespaceCrawler(ClientContext &context, IcebergCatalog &catalog, const vector<string> &parent)
+    : context(context), catalog(catalog) {
+	parents.push_back(parent);
+}
+
+bool IRCNamespaceCrawler::Next(vector<IRCAPISchema> &result) {
+	result.clear();
+	if (parents.empty()) {
+		return false;
+	}
+	vector<vector<IRCAPISchema>> listings(parents.size());
+	IcebergUtils::RunIndexedTasks(
+	    context, parents.size(), [&](idx_t i) { listings[i] = ListNamespaces(context, catalog, parents[i]); },
+	    IRCAPI::MAX_CONCURRENT_REQUESTS);
+	parents.clear();
+	for (auto &listing : listings) {
+		for (auto &schema : listing) {
+			if (catalog.attach_options.support_nested_namespaces) {
+				parents.push_back(schema.items);
+			}
+			result.push_back(std::move(schema));
+		}
+	}
+	return true;
+}
+
+vector<IRCAPISchema> IRCAPI::GetSchemas(ClientContext &context, IcebergCatalog &catalog, const vector<string> &parent) {
+	vector<IRCAPISchema> result;
+	IRCNamespaceCrawler crawler(context, catalog, parent);
+	vector<IRCAPISchema> level;
+	while (crawler.Next(level)) {
+		result.insert(result.end(), std::make_move_iterator(level.begin()), std::make_move_iterator(level.end()));
+	}
+	return result;
+}
+
 static CommitResult BuildCommitResult(ClientContext &context, const unique_ptr<HTTPResponse> &response) {
 	CommitResult result;
 	result.status = response->status;
@@ -9,10 +9,16 @@
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/storage/external_file_cache/caching_file_system.hpp"
 #include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/logging/logger.hpp"
 
+#include "core/expression/iceberg_predicate_stats.hpp"
 #include "core/metadata/manifest/iceberg_manifest_list.hpp"
 #include "catalog/rest/iceberg_table_set.hpp"
 #include "common/iceberg_utils.hpp"
+#include "iceberg_logging.hpp"
+
+#include <algorithm>
 
 namespace duckdb {
 
@@ -44,7 +50,8 @@ static optional<IcebergManifestListEntry> RewriteManifestFile(const IcebergManif
                                                               CopyFunction &avro_copy, DatabaseInstance &db,
                                                               IcebergCommitState &commit_state, int32_t schema_id,
                                                               const VersionedIcebergManifestDeletes &deletes,
-                                                              IcebergSnapshotMetrics &snapshot_metrics) {
+                                                              IcebergSnapshotMetrics &snapshot_metrics,
+                                                              mutex &metrics_lock) {
 	auto loaded_manifest = list_entry.HasManifestEntries()
 	                           ? list_entry
 	                           : IcebergManifestMerge::ScanManifestEntries(list_entry, commit_state, schema_id);
@@ -63,8 +70,11 @@ static optional<IcebergManifestListEntry> RewriteManifestFile(const IcebergManif
 			manifest_entry.status = IcebergManifestEntryStatusType::EXISTING;
 		}
 		if (manifest_entry.status != IcebergManifestEntryStatusType::DELETED &&
-		    deletes.IsInvalidated(manifest_entry.data_file.file_path)) {
-			snapshot_metrics.RemoveManifestEntry(manifest_entry);
+		    deletes.IsInvalidated(manifest_entry.data_file)) {
+			{
+				lock_guard<mutex> guard(metrics_lock);
+				snapshot_metrics.RemoveManifestEntry(manifest_entry);
+			}
 			manifest_entry.status = IcebergManifestEntryStatusType::DELETED;
 			removed_any_entries = true;
 		}
@@ -78,6 +88,125 @@ static optional<IcebergManifestListEntry> RewriteManifestFile(const IcebergManif
 	                                                      loaded_manifest.file.first_row_id);
 }
 
+namespace {
+
+//! Decides which manifests can hold a file invalidated by an alter, without reading them
+class InvalidatedFileFilter {
+public:
+	InvalidatedFileFilter(const IcebergTableMetadata &metadata, const vector<IcebergManifestListEntry> &manifests,
+	                      const VersionedIcebergManifestDeletes &deletes)
+	    : metadata(metadata) {
+		unordered_set<string> manifest_paths;
+		for (auto &manifest : manifests) {
+			manifest_paths.insert(manifest.file.manifest_path);
+		}
+		deletes.ForEachInvalidated([&](const IcebergManifestDeletes::InvalidatedFile &file) {
+			invalidates_files[file.is_delete_file] = true;
+			if (manifest_paths.count(file.manifest_path)) {
+				//! Manifests are immutable, a live file is in the manifest it was read from and in no other one
+				source_manifests.insert(file.manifest_path);
+				return;
+			}
+			//! The manifest the file was read from was rewritten since (by an earlier alter of this transaction, or a
+			//! concurrent commit), or it isn't known: the file can be in any manifest its partition fits in
+			unsourced_files[file.is_delete_file].push_back(file);
+		});
+	}
+
+public:
+	bool CanContainInvalidatedFiles(const IcebergManifestFile &manifest) const {
+		bool delete_files = manifest.content != IcebergManifestContentType::DATA;
+		if (!invalidates_files[delete_files]) {
+			return false;
+		}
+		auto &counts = manifest.counts;
+		if (counts && counts->added_files_count && counts->existing_files_count &&
+		    *counts->added_files_count + *counts->existing_files_count == 0) {
+			//! Only holds DELETED entries
+			return false;
+		}
+		if (source_manifests.count(manifest.manifest_path)) {
+			return true;
+		}
+		for (auto &file : unsourced_files[delete_files]) {
+			auto &partition = file.get().partition;
+			if (!partition || PartitionCanMatch(manifest, *partition)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+	//! Whether a file of 'partition' can be in 'manifest', going by the partition field summaries of the manifest
+	bool PartitionCanMatch(const IcebergManifestFile &manifest, const IcebergPartition &partition) const {
+		if (partition.partition_spec_id != manifest.partition_spec_id) {
+			//! All files of a manifest are written with the partition spec of the manifest
+			return false;
+		}
+		if (!manifest.partitions.has_partitions) {
+			return true;
+		}
+		auto partition_spec_it = metadata.partition_specs.find(manifest.partition_spec_id);
+		if (partition_spec_it == metadata.partition_specs.end()) {
+			return true;
+		}
+		auto &partition_spec = partition_spec_it->second;
+		auto &field_summaries = manifest.partitions.field_summary;
+		if (partition_spec.fields.size() != field_summaries.size()) {
+			return true;
+		}
+		for (idx_t field_idx = 0; field_idx < partition_spec.fields.size(); field_idx++) {
+			auto &field = partition_spec.fields[field_idx];
+			auto partition_value_it =
+			    std::find_if(partition.fields.begin(), partition.fields.end(), [&](const IcebergPartitionInfo &info) {
+				    return info.field_id == field.partition_field_id;
+			    });
+			if (partition_value_it == partition.fields.end()) {
+				continue;
+			}
+			auto &partition_value = partition_value_it->value;
+			auto &field_summary = field_summaries[field_idx];
+			if (partition_value.IsNull()) {
+				if (!field_summary.contains_null) {
+					return false;
+				}
+				continue;
+			}
+			auto source_column = metadata.FindColumnByFieldId(NumericCast<int32_t>(field.source_id));
+			if (!source_column) {
+				continue;
+			}
+			auto partition_type = field.transform.GetSerializedType(source_column->type);
+			if (partition_type.id() == LogicalTypeId::FLOAT || partition_type.id() == LogicalTypeId::DOUBLE) {
+				//! NaN is not covered by the bounds
+				continue;
+			}
+			auto stats = IcebergPredicateStats::DeserializeBounds(field_summary.lower_bound, field_summary.upper_bound,
+			                                                      source_column->name, partition_type);
+			auto typed_partition_value = partition_value.DefaultCastAs(partition_type);
+			if (stats.lower_bound && typed_partition_value < *stats.lower_bound) {
+				return false;
+			}
+			if (stats.upper_bound && typed_partition_value > *stats.upper_bound) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+private:
+	const IcebergTableMetadata &metadata;
+	//! Whether any data files (false) or delete files (true) were invalidated
+	bool invalidates_files[2] = {false, false};
+	//! The manifests the invalidated files were read from
+	unordered_set<string> source_manifests;
+	//! The invalidated data files (false) and delete files (true) that are not in the manifest they were read from
+	vector<reference<const IcebergManifestDeletes::InvalidatedFile>> unsourced_files[2];
+};
+
+} // namespace
+
 static void AddManifestListEntry(IcebergManifestList &new_manifest_list, IcebergManifestListEntry &&manifest_entry) {
 	if (!manifest_entry.file.added_snapshot_id) {
 		new_manifest_list.AddNewManifestFile(std::move(manifest_entry));
@@ -99,14 +228,33 @@ void IcebergAddSnapshot::ConstructManifestList(IcebergManifestList &new_manifest
 		return;
 	}
 
-	for (auto &manifest_list_entry : commit_state.manifests) {
-		auto rewritten_manifest = RewriteManifestFile(manifest_list_entry, avro_copy, db, commit_state, schema_id,
-		                                              *manifest_deletes, snapshot_metrics);
+	//! Only the manifests that can hold an invalidated file are read (and rewritten), in parallel
+	auto &manifests = commit_state.manifests;
+	InvalidatedFileFilter filter(commit_state.table_info.table_metadata, manifests, *manifest_deletes);
+	vector<idx_t> candidates;
+	for (idx_t i = 0; i < manifests.size(); i++) {
+		if (filter.CanContainInvalidatedFiles(manifests[i].file)) {
+			candidates.push_back(i);
+		}
+	}
+	DUCKDB_LOG(commit_state.context, IcebergLogType,
+	           "phase=rewrite_manifests manifests=%llu candidates=%llu", manifests.size(), candidates.size());
+
+	vector<optional<IcebergManifestListEntry>> rewritten_manifests(manifests.size());
+	mutex metrics_lock;
+	IcebergUtils::RunIndexedTasks(commit_state.context, candidates.size(), [&](idx_t candidate_idx) {
+		auto manifest_idx = candidates[candidate_idx];
+		rewritten_manifests[manifest_idx] =
+		    RewriteManifestFile(manifests[manifest_idx], avro_copy, db, commit_state, schema_id, *manifest_deletes,
+		                        snapshot_metrics, metrics_lock);
+	});
+
+	for (idx_t i = 0; i < manifests.size(); i++) {
+		auto &rewritten_manifest = rewritten_manifests[i];
 		if (!rewritten_manifest) {
-			AddManifestListEntry(new_manifest_list, std::move(manifest_list_entry));
+			AddManifestListEntry(new_manifest_list, std::move(manifests[i]));
 			continue;
 		}
-
 		new_manifest_list.AddNewManifestFile(std::move(*rewritten_manifest));
 	}
 	commit_state.manifests.clear();
@@ -173,7 +321,8 @@ void IcebergAddSnapshot::CreateUpdate(DatabaseInstance &db, ClientContext &conte
 	const auto sequence_number = commit_state.next_sequence_number++;
 	auto uncommitted_manifest_files =
 	    CreateCommitManifestFiles(manifest_files, commit_state.table_info, commit_state, sequence_number);
-	D_ASSERT(!uncommitted_manifest_files.empty());
+	//! A copy-on-write DELETE of every row of its data files only removes files, it adds no manifest
+	D_ASSERT(!uncommitted_manifest_files.empty() || manifest_deletes);
 
 	auto &fs = FileSystem::GetFileSystem(context);
 	auto manifest_list_uuid = UUID::ToString(UUID::GenerateRandomUUID());
@@ -4,6 +4,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/map.hpp"
 #include "duckdb/logging/logger.hpp"
+#include "common/iceberg_utils.hpp"
 
 #include "catalog/rest/api/iceberg_table_update.hpp"
 #include "catalog/rest/catalog_entry/table/iceberg_table.hpp"
@@ -11,8 +12,10 @@
 #include "core/metadata/iceberg_table_metadata.hpp"
 #include "planning/metadata_io/avro/avro_scan.hpp"
 #include "planning/metadata_io/manifest/iceberg_manifest_reader.hpp"
+#include "iceberg_logging.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <string>
 
 namespace duckdb {
@@ -173,9 +176,28 @@ bool IcebergManifestMerge::ShouldMergeBin(const vector<idx_t> &bin, idx_t min_co
 IcebergManifestListEntry IcebergManifestMerge::ScanManifestEntries(const IcebergManifestListEntry &list_entry,
                                                                    IcebergCommitState &commit_state,
                                                                    int32_t schema_id) {
+	IcebergManifestListEntry result(list_entry.file);
+	result.metrics = list_entry.metrics;
+	auto &manifest_entries = result.GetOrCreateManifestEntries();
+	auto manifest_metadata =
+	    StreamManifestEntries(list_entry, commit_state, schema_id, [&](vector<IcebergManifestEntry> &entries) {
+		    manifest_entries.insert(manifest_entries.end(), std::make_move_iterator(entries.begin()),
+		                            std::make_move_iterator(entries.end()));
+		    return true;
+	    });
+	result.manifest_metadata.emplace(manifest_metadata);
+	result.file.SetCountsFromEntries(manifest_entries);
+	return result;
+}
+
+IcebergManifestMetadata IcebergManifestMerge::StreamManifestEntries(
+    const IcebergManifestListEntry &list_entry, IcebergCommitState &commit_state, int32_t schema_id,
+    const std::function<bool(vector<IcebergManifestEntry> &)> &callback) {
 	vector<IcebergManifestListEntry> manifest_files;
-	manifest_files.push_back(list_entry);
-	manifest_files[0].manifest_entries.reset();
+	manifest_files.emplace_back(list_entry.file);
+	if (list_entry.manifest_metadata) {
+		manifest_files[0].manifest_metadata.emplace(*list_entry.manifest_metadata);
+	}
 
 	IcebergOptions options;
 	auto &fs = FileSystem::GetFileSystem(commit_state.context);
@@ -188,12 +210,25 @@ IcebergManifestListEntry IcebergManifestMerge::ScanManifestEntries(const Iceberg
 	auto manifest_scan =
 	    AvroScan::ScanManifest(snapshot_info, manifest_files, options, fs, "", table_metadata, commit_state.context);
 	auto reader = make_uniq<manifest_file::ManifestReader>(*manifest_scan);
+	auto &scanned = manifest_files[0];
 	while (!reader->Finished()) {
+		//! Every read decodes a single chunk into the scanned entry, take the entries out again right away so at
+		//! most one chunk of the manifest is held in memory
 		reader->Read();
+		if (!scanned.HasManifestEntries() || scanned.GetManifestEntries().empty()) {
+			continue;
+		}
+		vector<IcebergManifestEntry> entries;
+		std::swap(entries, scanned.GetManifestEntries());
+		if (!callback(entries)) {
+			break;
+		}
 	}
-	auto result = std::move(manifest_files[0]);
-	result.file.SetCountsFromEntries(result.GetManifestEntries());
-	return result;
+	if (!scanned.manifest_metadata) {
+		throw InvalidConfigurationException("Could not read the metadata of manifest '%s'",
+		                                    list_entry.file.manifest_path);
+	}
+	return *scanned.manifest_metadata;
 }
 
 IcebergManifestListEntry IcebergManifestMerge::WriteReplacementManifest(
@@ -210,22 +245,30 @@ IcebergManifestListEntry IcebergManifestMerge::WriteReplacementManifest(
 
 	auto manifest_length = manifest_file::WriteToFile(table_metadata, result, avro_copy, db, commit_state.context);
 	result.file.manifest_length = manifest_length;
-	commit_state.created_metadata_files.push_back(result.file.manifest_path);
+	{
+		lock_guard<mutex> guard(commit_state.lock);
+		commit_state.created_metadata_files.push_back(result.file.manifest_path);
+	}
 	return result;
 }
 
 namespace {
 
-//! Merge one spec-homogeneous bin into a single new manifest. Returns the new list entry.
+//! The combined file size (the compressed Avro bytes, not the size of the decoded entries) of the member manifests
+//! that a merge reads concurrently
+constexpr int64_t MERGE_READ_WINDOW_FILE_BYTES = 16 * 1024 * 1024;
+
+//! Merge one spec-homogeneous bin into a single new manifest. The member manifests are read a window at a time and
+//! written to the new manifest before the next window is read, so memory is proportional to the file bytes of a window
+//! and not to the size of the bin. Returns the new list entry, or nothing if the bin has no entries.
 optional<IcebergManifestListEntry> MergeBin(const vector<IcebergManifestListEntry> &input, const vector<idx_t> &bin,
                                             IcebergManifestContentType content, CopyFunction &avro_copy,
                                             DatabaseInstance &db, IcebergCommitState &commit_state, int32_t schema_id,
                                             int32_t partition_spec_id) {
+	auto &context = commit_state.context;
 	auto &table_metadata = commit_state.table_info.table_metadata;
 	const bool is_v3 = table_metadata.iceberg_version >= 3;
 
-	//! Gather every entry from the bin's manifests, preserving status and historical sequence numbers.
-	vector<IcebergManifestEntry> merged_entries;
 	//! Merging is a pure physical repack: it creates no new rows, so V3 row lineage must be
 	//! preserved, not reassigned. The first_row_id is a manifest-file-level value, so the merged
 	//! manifest's first_row_id is the smallest first_row_id among the manifests it absorbs.
@@ -234,12 +277,6 @@ optional<IcebergManifestListEntry> MergeBin(const vector<IcebergManifestListEntr
 	//! DATA manifest earlier in the commit (see IcebergTransactionData's upgrade handling), and new
 	//! V3 data manifests are excluded from merging (they inherit their id only at write time).
 	optional<int64_t> min_first_row_id;
-	//! The merged manifest's min_sequence_number must be the smallest data_sequence_number among its
-	//! entries. CreateFromEntries cannot compute this (it derives it from the manifest-file sequence
-	//! number, which is a placeholder here), so we track the true minimum and set it ourselves before
-	//! the manifest is written / handed to AddNewManifestFile. If left as the placeholder, scan
-	//! planning's `seq > X` pruning would mis-judge which historical data the manifest can contain.
-	optional<int64_t> min_seq;
 	for (auto idx : bin) {
 		auto &member = input[idx];
 		if (is_v3 && member.file.first_row_id.has_value()) {
@@ -247,10 +284,27 @@ optional<IcebergManifestListEntry> MergeBin(const vector<IcebergManifestListEntr
 				min_first_row_id = *member.file.first_row_id;
 			}
 		}
-		auto loaded = member.HasManifestEntries()
-		                  ? member
-		                  : IcebergManifestMerge::ScanManifestEntries(member, commit_state, schema_id);
-		auto &loaded_entries = loaded.GetManifestEntries();
+	}
+
+	//! The counts, metrics and partition field summary are gathered per chunk while the entries are written; pass
+	//! the bin's own spec id so the summary is computed against the correct (possibly historical) spec, not the
+	//! table default.
+	auto manifest_metadata = IcebergManifestMetadata(schema_id, partition_spec_id,
+	                                                 NumericCast<int32_t>(table_metadata.iceberg_version), content);
+	int64_t scratch_row_id = 0;
+	auto result = IcebergManifestListEntry::CreateEmpty(FileSystem::GetFileSystem(context), /*sequence_number*/ 0,
+	                                                    table_metadata, manifest_metadata, scratch_row_id);
+	ManifestSummaryBuilder summary(table_metadata, result);
+	manifest_file::ManifestFileWriter writer(table_metadata, result, avro_copy, db, context);
+
+	//! The merged manifest's min_sequence_number must be the smallest data_sequence_number among its
+	//! entries. The summary cannot compute this (it derives it from the manifest-file sequence
+	//! number, which is a placeholder here), so we track the true minimum and set it ourselves before
+	//! the manifest is handed to AddNewManifestFile. If left as the placeholder, scan
+	//! planning's `seq > X` pruning would mis-judge which historical data the manifest can contain.
+	optional<int64_t> min_seq;
+	auto append_member = [&](const IcebergManifestListEntry &member,
+	                         optional_ptr<const vector<IcebergManifestEntry>> member_entries) {
 		//! V3 row lineage: a data file's _row_id is derived from its data_file.first_row_id (+ row
 		//! position). That id is normally left null on disk and inherited at read time from the
 		//! manifest's first_row_id plus the record_count of preceding files that also lack one. Merging
@@ -258,60 +312,112 @@ optional<IcebergManifestListEntry> MergeBin(const vector<IcebergManifestListEntr
 		//! the inherited ids would be re-derived against that new base. The Iceberg spec requires the
 		//! inherited value to be materialized into the data file metadata when creating existing/deleted
 		//! entries, so we compute each entry's first_row_id here -- against THIS source manifest's
-		//! first_row_id -- before the entries are moved into the merged manifest. That makes the merged
-		//! row ids independent of the merged layout. (DELETE manifests carry no first_row_id, so this
+		//! first_row_id, carried across the chunks of the manifest -- before the entries are written. That makes
+		//! the merged row ids independent of the merged layout. (DELETE manifests carry no first_row_id, so this
 		//! only applies to DATA content.)
-		//!
-		//! Note: with today's ordering invariants (carried-over manifests are prepended in first_row_id
-		//! order and are contiguous), reading back would recompute the same ids even without this step;
-		//! materializing is spec-compliant and keeps correctness independent of those invariants.
+		optional<int64_t> inherited_row_id;
 		if (is_v3 && content == IcebergManifestContentType::DATA && member.file.first_row_id.has_value()) {
-			int64_t inherited_row_id = *member.file.first_row_id;
-			for (auto &entry : loaded_entries) {
-				if (!entry.data_file.HasFirstRowId()) {
-					entry.data_file.SetFirstRowId(inherited_row_id);
-					inherited_row_id += entry.data_file.record_count;
+			inherited_row_id = *member.file.first_row_id;
+		}
+		auto merge_entries = [&](vector<IcebergManifestEntry> &entries) {
+			for (auto &entry : entries) {
+				if (inherited_row_id && !entry.data_file.HasFirstRowId()) {
+					entry.data_file.SetFirstRowId(*inherited_row_id);
+					*inherited_row_id += entry.data_file.record_count;
+				}
+				//! These are already-committed manifests. Any ADDED entry describes a file added by an
+				//! earlier snapshot and must be materialized as EXISTING in the replacement manifest.
+				if (entry.status == IcebergManifestEntryStatusType::ADDED) {
+					auto seq = entry.GetSequenceNumber(member.file);
+					auto file_seq = entry.GetFileSequenceNumber(member.file);
+					entry.SetSequenceNumber(seq);
+					entry.SetFileSequenceNumber(file_seq);
+					entry.status = IcebergManifestEntryStatusType::EXISTING;
+				}
+				//! Live entries determine the manifest's minimum data sequence number.
+				auto entry_seq = entry.GetSequenceNumber(member.file);
+				if (!min_seq || entry_seq < *min_seq) {
+					min_seq = entry_seq;
 				}
 			}
+			summary.Update(entries, scratch_row_id);
+			writer.Append(entries);
+			return true;
+		};
+		if (!member_entries) {
+			IcebergManifestMerge::StreamManifestEntries(member, commit_state, schema_id, merge_entries);
+			return;
+		}
+		//! Already in memory, copy it a chunk at a time
+		for (idx_t offset = 0; offset < member_entries->size(); offset += STANDARD_VECTOR_SIZE) {
+			auto end = MinValue<idx_t>(offset + STANDARD_VECTOR_SIZE, member_entries->size());
+			vector<IcebergManifestEntry> entries(member_entries->begin() + NumericCast<int64_t>(offset),
+			                                     member_entries->begin() + NumericCast<int64_t>(end));
+			merge_entries(entries);
 		}
-		for (auto &entry : loaded_entries) {
-			//! These are already-committed manifests. Any ADDED entry describes a file added by an
-			//! earlier snapshot and must be materialized as EXISTING in the replacement manifest.
-			if (entry.status == IcebergManifestEntryStatusType::ADDED) {
-				auto seq = entry.GetSequenceNumber(member.file);
-				auto file_seq = entry.GetFileSequenceNumber(member.file);
-				entry.SetSequenceNumber(seq);
-				entry.SetFileSequenceNumber(file_seq);
-				entry.status = IcebergManifestEntryStatusType::EXISTING;
+	};
+
+	//! The members are written in order, a window of them at a time. The members of a window that aren't in memory
+	//! yet are read concurrently; the window is bounded by the size of their manifest files, so the decoded entries
+	//! held at once stay bounded too. A member that fills a window on its own is streamed a chunk at a time instead.
+	idx_t window_start = 0;
+	while (window_start < bin.size()) {
+		vector<idx_t> reads;
+		int64_t window_bytes = 0;
+		idx_t window_end = window_start;
+		for (; window_end < bin.size(); window_end++) {
+			auto &member = input[bin[window_end]];
+			if (member.HasManifestEntries()) {
+				continue;
 			}
-			//! Live entries determine the manifest's minimum data sequence number.
-			auto entry_seq = entry.GetSequenceNumber(member.file);
-			if (!min_seq || entry_seq < *min_seq) {
-				min_seq = entry_seq;
+			if (!reads.empty() && window_bytes + member.file.manifest_length > MERGE_READ_WINDOW_FILE_BYTES) {
+				break;
 			}
-			merged_entries.push_back(std::move(entry));
+			reads.push_back(window_end);
+			window_bytes += member.file.manifest_length;
 		}
+
+		vector<optional<IcebergManifestListEntry>> loaded(window_end - window_start);
+		if (reads.size() > 1) {
+			IcebergUtils::RunIndexedTasks(context, reads.size(), [&](idx_t read_idx) {
+				auto bin_idx = reads[read_idx];
+				loaded[bin_idx - window_start] =
+				    IcebergManifestMerge::ScanManifestEntries(input[bin[bin_idx]], commit_state, schema_id);
+			});
+		}
+		for (idx_t bin_idx = window_start; bin_idx < window_end; bin_idx++) {
+			auto &member = input[bin[bin_idx]];
+			auto &loaded_member = loaded[bin_idx - window_start];
+			if (loaded_member) {
+				append_member(member, &loaded_member->GetManifestEntries());
+				loaded_member.reset();
+			} else if (member.HasManifestEntries()) {
+				append_member(member, &member.GetManifestEntries());
+			} else {
+				append_member(member, nullptr);
+			}
+		}
+		window_start = window_end;
 	}
 
-	//! A bin can collapse to nothing (e.g. every entry was a DELETED-by-an-earlier-snapshot entry and
-	//! was filtered out above). An empty manifest must never be written -- WriteToFile asserts on it
-	//! (and an empty Avro manifest is meaningless). Return an entry with no manifest_entries so the
-	//! caller drops it; do this BEFORE CreateFromEntries/WriteToFile.
-	if (merged_entries.empty()) {
+	//! A bin can collapse to nothing (e.g. every member manifest turned out to be empty). An empty
+	//! manifest must never be written (an empty Avro manifest is meaningless); the writer only creates
+	//! the file on its first append, so nothing was written and the caller drops the bin.
+	if (writer.RowCount() == 0) {
 		return std::nullopt;
 	}
-
-	//! CreateFromEntries computes all counts, min_sequence_number and the partition field summary
-	//! from the entries; pass the bin's own spec id so the summary is computed against the correct
-	//! (possibly historical) spec, not the table default.
-	auto manifest_metadata = IcebergManifestMetadata(schema_id, partition_spec_id,
-	                                                 NumericCast<int32_t>(table_metadata.iceberg_version), content);
-	auto first_row_id =
+	summary.Finalize();
+	result.file.manifest_length = NumericCast<int64_t>(writer.Finalize());
+	result.file.first_row_id =
 	    is_v3 && content == IcebergManifestContentType::DATA && min_first_row_id ? min_first_row_id : nullopt;
-	//! Set the true minimum data sequence number from the absorbed entries (see above). Done before
-	//! WriteToFile / AddNewManifestFile so scan-planning pruning sees the correct lower bound.
-	return IcebergManifestMerge::WriteReplacementManifest(manifest_metadata, std::move(merged_entries), avro_copy, db,
-	                                                      commit_state, first_row_id, min_seq);
+	//! Set the true minimum data sequence number from the absorbed entries (see above), so scan-planning pruning
+	//! sees the correct lower bound.
+	result.file.min_sequence_number = min_seq;
+	{
+		lock_guard<mutex> guard(commit_state.lock);
+		commit_state.created_metadata_files.push_back(result.file.manifest_path);
+	}
+	return result;
 }
 
 } // namespace
@@ -330,17 +436,20 @@ vector<IcebergManifestListEntry> IcebergManifestMerge::MergeManifests(vector<Ice
 		return result;
 	}
 
-	//! Load the entries of the manifests if they're not already loaded
-	for (auto &member : input) {
-		if (member.HasManifestEntries()) {
-			//! Already loaded, no need to scan
-			continue;
+	//! Grouping only needs the schema id of the manifests, which is part of the Avro header. Read it for the manifests
+	//! that don't have it yet (stopping after the first chunk), the entries are streamed when a bin is merged
+	vector<idx_t> unresolved;
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (!input[i].manifest_metadata) {
+			unresolved.push_back(i);
 		}
-		auto loaded = IcebergManifestMerge::ScanManifestEntries(member, commit_state, current_schema_id);
-		member.file = std::move(loaded.file);
-		member.manifest_entries = std::move(loaded.manifest_entries);
-		member.manifest_metadata.emplace(*loaded.manifest_metadata);
 	}
+	IcebergUtils::RunIndexedTasks(commit_state.context, unresolved.size(), [&](idx_t unresolved_idx) {
+		auto &member = input[unresolved[unresolved_idx]];
+		auto manifest_metadata = IcebergManifestMerge::StreamManifestEntries(
+		    member, commit_state, current_schema_id, [](vector<IcebergManifestEntry> &) { return false; });
+		member.manifest_metadata.emplace(manifest_metadata);
+	});
 
 	//! Group by spec_id+schema_id, so we only merge manifests that are compatible
 	map<std::pair<int32_t, int32_t>, vector<idx_t>> groups;
@@ -350,6 +459,16 @@ vector<IcebergManifestListEntry> IcebergManifestMerge::MergeManifests(vector<Ice
 		groups[std::make_pair(schema_id, spec_id)].push_back(i);
 	}
 
+	//! The output in order: either a manifest that is passed through, or a bin that is merged
+	struct MergeOutput {
+		optional_idx passthrough_idx;
+		vector<idx_t> bin;
+		int32_t schema_id = 0;
+		int32_t spec_id = 0;
+		optional<IcebergManifestListEntry> merged;
+	};
+	vector<MergeOutput> outputs;
+	vector<idx_t> merged_outputs;
 	for (auto &group : groups) {
 		auto schema_id = group.first.first;
 		auto spec_id = group.first.second;
@@ -374,19 +493,39 @@ vector<IcebergManifestListEntry> IcebergManifestMerge::MergeManifests(vector<Ice
 
 			if (!IcebergManifestMerge::ShouldMergeBin(bin, config.min_count_to_merge)) {
 				for (auto idx : bin) {
-					result.push_back(std::move(input[idx]));
+					MergeOutput output;
+					output.passthrough_idx = idx;
+					outputs.push_back(std::move(output));
 				}
 				continue;
 			}
+			MergeOutput output;
+			output.bin = std::move(bin);
+			output.schema_id = schema_id;
+			output.spec_id = spec_id;
+			merged_outputs.push_back(outputs.size());
+			outputs.push_back(std::move(output));
+		}
+	}
 
-			auto merged = MergeBin(input, bin, content, avro_copy, db, commit_state, schema_id, spec_id);
-			//! A bin can collapse to nothing (e.g. all entries were deleted and filtered out); never
-			//! write or reference an empty manifest.
-			if (!merged) {
-				continue;
-			}
-			result.push_back(std::move(*merged));
+	//! The bins are merged concurrently, each writes its own replacement manifest
+	IcebergUtils::RunIndexedTasks(commit_state.context, merged_outputs.size(), [&](idx_t merge_idx) {
+		auto &output = outputs[merged_outputs[merge_idx]];
+		output.merged =
+		    MergeBin(input, output.bin, content, avro_copy, db, commit_state, output.schema_id, output.spec_id);
+	});
+
+	for (auto &output : outputs) {
+		if (output.passthrough_idx.IsValid()) {
+			result.push_back(std::move(input[output.passthrough_idx.GetIndex()]));
+			continue;
+		}
+		//! A bin can collapse to nothing (e.g. all entries were deleted and filtered out); never
+		//! write or reference an empty manifest.
+		if (!output.merged) {
+			continue;
 		}
+		result.push_back(std::move(*output.merged));
 	}
 	return result;
 }
@@ -411,6 +550,8 @@ void IcebergManifestMerge::MergeManifestList(vector<IcebergManifestListEntry> &m
 		target.push_back(std::move(entry));
 	}
 
+	auto start = std::chrono::steady_clock::now();
+	auto input_count = manifests.size();
 	auto merged_data = IcebergManifestMerge::MergeManifests(std::move(data_input), IcebergManifestContentType::DATA,
 	                                                        config, avro_copy, db, commit_state, current_schema_id);
 	auto merged_delete =
@@ -424,6 +565,10 @@ void IcebergManifestMerge::MergeManifestList(vector<IcebergManifestListEntry> &m
 	for (auto &entry : merged_delete) {
 		manifests.push_back(std::move(entry));
 	}
+	auto elapsed_ms =
+	    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	DUCKDB_LOG(commit_state.context, IcebergManifestMergeLogType, commit_state.table_info.GetTableKey(), input_count,
+	           manifests.size(), static_cast<int64_t>(elapsed_ms));
 }
 
 } // namespace duckdb
@@ -99,7 +99,8 @@ static string GetRequiredString(JSONValue obj, const char *key) {
 	return value.GetString();
 }
 
-static void CopyCountMap(const optional<rest_api_objects::CountMap> &source, unordered_map<int32_t, int64_t> &target) {
+static void CopyCountMap(const optional<rest_api_objects::CountMap> &source, IcebergColumnStatType type,
+                         IcebergColumnStats &target) {
 	if (!source || !source->keys || !source->values) {
 		return;
 	}
@@ -107,7 +108,7 @@ static void CopyCountMap(const optional<rest_api_objects::CountMap> &source, uno
 		throw InvalidInputException("Iceberg server-side scan-planning returned a malformed CountMap");
 	}
 	for (idx_t i = 0; i < source->keys->size(); i++) {
-		target[(*source->keys)[i].value] = (*source->values)[i].value;
+		target.SetCount(type, (*source->keys)[i].value, (*source->values)[i].value);
 	}
 }
 
@@ -131,7 +132,7 @@ static string DecodeHexValue(const string &value, int32_t field_id) {
 }
 
 static void CopyValueMap(const optional<rest_api_objects::ValueMap> &source, const IcebergTableMetadata &metadata,
-                         unordered_map<int32_t, Value> &target) {
+                         IcebergColumnStatType type, IcebergColumnStats &target) {
 	if (!source || !source->keys || !source->values) {
 		return;
 	}
@@ -155,7 +156,7 @@ static void CopyValueMap(const optional<rest_api_objects::ValueMap> &source, con
 
 		// The REST API represents the Iceberg bound bytes as a hexadecimal string. Preserve the decoded bytes here;
 		// consumers deserialize the BLOB using the column's Iceberg type.
-		target[field_id] = Value::BLOB_RAW(DecodeHexValue(serialized_value.binary_type_value->value, field_id));
+		target.SetBound(type, field_id, string_t(DecodeHexValue(serialized_value.binary_type_value->value, field_id)));
 	}
 }
 
@@ -212,12 +213,13 @@ static PlannedContentFile ConvertDataFile(const rest_api_objects::DataFile &sour
                                           const IcebergTableMetadata &metadata) {
 	auto result = ConvertContentFile(source.content_file, metadata, IcebergManifestEntryContentType::DATA);
 	result.SetFirstRowId(source.first_row_id);
-	CopyCountMap(source.column_sizes, result.column_sizes);
-	CopyCountMap(source.value_counts, result.value_counts);
-	CopyCountMap(source.null_value_counts, result.null_value_counts);
-	CopyCountMap(source.nan_value_counts, result.nan_value_counts);
-	CopyValueMap(source.lower_bounds, metadata, result.lower_bounds);
-	CopyValueMap(source.upper_bounds, metadata, result.upper_bounds);
+	auto &column_stats = result.column_stats;
+	CopyCountMap(source.column_sizes, IcebergColumnStatType::COLUMN_SIZE, column_stats);
+	CopyCountMap(source.value_counts, IcebergColumnStatType::VALUE_COUNT, column_stats);
+	CopyCountMap(source.null_value_counts, IcebergColumnStatType::NULL_VALUE_COUNT, column_stats);
+	CopyCountMap(source.nan_value_counts, IcebergColumnStatType::NAN_VALUE_COUNT, column_stats);
+	CopyValueMap(source.lower_bounds, metadata, IcebergColumnStatType::LOWER_BOUND, column_stats);
+	CopyValueMap(source.upper_bounds, metadata, IcebergColumnStatType::UPPER_BOUND, column_stats);
 	return PlannedContentFile {std::move(result), source.content_file.spec_id};
 }
 
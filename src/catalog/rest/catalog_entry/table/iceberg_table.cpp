@@ -662,7 +662,43 @@ void IcebergTable::RefreshFromCatalog(ClientContext &context) {
 	schema_versions.clear();
 	dummy_entry.reset();
 	InitializeFromLoadTableResult(load_table_result);
-	ic_catalog.table_request_cache.SetOrOverwrite(table_key, std::move(get_table_result.result_));
+	ic_catalog.table_request_cache.SetOrOverwrite(table_key, std::move(get_table_result.result_),
+	                                              get_table_result.etag_);
+}
+
+void IcebergTable::LoadAllSnapshots(ClientContext &context) {
+	if (has_all_snapshots) {
+		return;
+	}
+	LoadAllSnapshots(context, table_metadata);
+	has_all_snapshots = true;
+}
+
+void IcebergTable::LoadAllSnapshots(ClientContext &context, IcebergTableMetadata &metadata) const {
+	if (has_all_snapshots) {
+		return;
+	}
+	auto &ic_catalog = catalog.Cast<IcebergCatalog>();
+	auto get_table_result = IRCAPI::GetTable(context, ic_catalog, schema, name, string(), true);
+	if (get_table_result.error_) {
+		throw HTTPException(
+		    StringUtil::Format("GetTableInformation endpoint returned response code %s with message \"%s\"",
+		                       EnumUtil::ToString(get_table_result.status_), get_table_result.error_->_error.message));
+	}
+	auto &snapshots = get_table_result.result_->metadata.snapshots;
+	if (!snapshots) {
+		return;
+	}
+	for (auto &snapshot : *snapshots) {
+		if (metadata.snapshots.count(snapshot.snapshot_id)) {
+			continue;
+		}
+		// the table may have changed since it was loaded, leave out the snapshots committed after that
+		if (timestamp_ms_t(snapshot.timestamp_ms) > metadata.last_updated_ms) {
+			continue;
+		}
+		metadata.snapshots.emplace(snapshot.snapshot_id, IcebergSnapshot::ParseSnapshot(snapshot, metadata));
+	}
 }
 
 IcebergTable IcebergTable::Copy() const {
@@ -670,6 +706,7 @@ IcebergTable IcebergTable::Copy() const {
 	clone.table_metadata = table_metadata.Copy();
 	clone.config = config;
 	clone.initialization_source = initialization_source;
+	clone.has_all_snapshots = has_all_snapshots;
 	for (auto &credential : storage_credentials) {
 		clone.storage_credentials.push_back(credential.Copy());
 	}
@@ -734,6 +771,8 @@ IcebergTable IcebergTable::Copy(IcebergTransaction &iceberg_transaction) const {
 
 	LoadCredentials(context);
 	ret.table_metadata = ret.CreateMetadataFromLog(context, transaction_start_ms);
+	// metadata files always contain every snapshot
+	ret.has_all_snapshots = true;
 	return ret;
 }
 
@@ -753,6 +792,12 @@ IcebergTransactionData &IcebergTable::GetOrCreateTransactionData(IcebergTransact
 	if (!transaction_data) {
 		auto context = transaction.context.lock();
 		transaction_data = make_uniq<IcebergTransactionData>(*context, transaction, *this);
+		if (catalog.group_commit.Enabled()) {
+			auto table_key = GetTableKey();
+			if (transaction.pending_group_commits.insert(table_key).second) {
+				catalog.group_commit.AddPendingCommit(table_key);
+			}
+		}
 	}
 	return *transaction_data;
 }
@@ -760,6 +805,7 @@ IcebergTransactionData &IcebergTable::GetOrCreateTransactionData(IcebergTransact
 void IcebergTable::InitializeFromLoadTableResult(const rest_api_objects::LoadTableResult &load_table_result) {
 	initialization_source = load_table_result;
 	table_metadata = IcebergTableMetadata::FromTableMetadata(load_table_result.metadata);
+	has_all_snapshots = catalog.attach_options.snapshot_loading_mode == IcebergSnapshotLoadingMode::ALL;
 	if (auto &val = load_table_result.config) {
 		config = *val;
 	}
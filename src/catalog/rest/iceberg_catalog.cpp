@@ -18,6 +18,7 @@
 #include "common/iceberg_utils.hpp"
 #include "iceberg_logging.hpp"
 #include "catalog/rest/api/api_utils.hpp"
+#include "planning/scan_plan/iceberg_scan_plan_cache.hpp"
 #include "rest_catalog/objects/catalog_config.hpp"
 
 namespace duckdb {
@@ -40,7 +41,9 @@ IcebergCatalog::IcebergCatalog(AttachedDatabase &db_p, AccessMode access_mode,
     : Catalog(db_p), access_mode(access_mode), auth_handler(std::move(auth_handler)),
       base_uri(attach_options_p.catalog_uri), version("v1"), attach_options(attach_options_p),
       default_schema(default_schema), warehouse(attach_options.warehouse), schemas(*this),
-      table_request_cache(attach_options) {
+      table_request_cache(attach_options),
+      scan_plan_cache(make_shared_ptr<IcebergScanPlanCache>(attach_options.scan_plan_cache_size)),
+      group_commit(attach_options.group_commit_window_micros), table_refresher(*this) {
 }
 
 IcebergCatalog::~IcebergCatalog() = default;
@@ -468,10 +471,10 @@ bool IcebergCatalog::HasConflictingAttachOptions(const string &path, const Attac
 	return false;
 }
 
-string IcebergCatalog::GetOnlyMergeOnReadSupportedErrorMessage(const string &table_name, const string &property,
-                                                               const string &property_value) {
-	return StringUtil::Format("DuckDB-Iceberg only supports merge-on-read for updates/deletes. Table Property '%s' is "
-	                          "set to '%s' for table %s"
+string IcebergCatalog::GetUnsupportedWriteModeErrorMessage(const string &table_name, const string &property,
+                                                           const string &property_value) {
+	return StringUtil::Format("DuckDB-Iceberg only supports merge-on-read and copy-on-write for updates/deletes. Table "
+	                          "Property '%s' is set to '%s' for table %s. "
 	                          "You can modify Iceberg table properties wth the set_iceberg_table_properties() "
 	                          "function, and remove them with the remove_iceberg_table_properties() function. "
 	                          "You can view Iceberg table properties with the iceberg_table_properties() function",
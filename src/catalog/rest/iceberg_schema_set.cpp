@@ -143,15 +143,20 @@ void IcebergSchemaSet::LoadEntriesInternal(ClientContext &context) {
 	if (schema_listed) {
 		return;
 	}
-	auto schemas = IRCAPI::GetSchemas(context, ic_catalog, {});
-	for (const auto &schema : schemas) {
-		CreateSchemaInfo info;
-		info.SetQualifiedName(QualifiedName(info.GetQualifiedName().Catalog(), Identifier(GetSchemaName(schema.items)),
-		                                    info.GetQualifiedName().Name()));
-		info.internal = false;
-		auto schema_entry = make_shared_ptr<IcebergSchemaEntry>(catalog, info);
-		schema_entry->namespace_items = std::move(schema.items);
-		CreateEntryInternal(std::move(schema_entry));
+	// add the namespaces level by level as the crawler discovers them
+	IRCNamespaceCrawler crawler(context, ic_catalog, {});
+	vector<IRCAPISchema> schemas;
+	while (crawler.Next(schemas)) {
+		for (auto &schema : schemas) {
+			CreateSchemaInfo info;
+			Identifier schema_name(GetSchemaName(schema.items));
+			info.SetQualifiedName(
+			    QualifiedName(info.GetQualifiedName().Catalog(), schema_name, info.GetQualifiedName().Name()));
+			info.internal = false;
+			auto schema_entry = make_shared_ptr<IcebergSchemaEntry>(catalog, info);
+			schema_entry->namespace_items = std::move(schema.items);
+			CreateEntryInternal(std::move(schema_entry));
+		}
 	}
 	iceberg_transaction.called_list_schemas = true;
 }
@@ -0,0 +1,203 @@
+#include "catalog/rest/iceberg_table_prefetch.hpp"
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+
+#include "catalog/rest/api/catalog_api.hpp"
+#include "catalog/rest/iceberg_catalog.hpp"
+#include "catalog/rest/catalog_entry/schema/iceberg_schema_entry.hpp"
+#include "catalog/rest/catalog_entry/table/iceberg_table.hpp"
+#include "catalog/rest/transaction/iceberg_transaction.hpp"
+#include "common/iceberg_utils.hpp"
+
+namespace duckdb {
+
+namespace {
+
+//! Collects the (schema, table) names of the base tables of this catalog referenced by a statement
+class TableReferenceCollector {
+public:
+	TableReferenceCollector(ClientContext &context, IcebergCatalog &catalog)
+	    : catalog_name(catalog.GetName().GetIdentifierName()),
+	      default_schema(catalog.GetDefaultSchema().GetIdentifierName()),
+	      is_default_catalog(StringUtil::CIEquals(DatabaseManager::GetDefaultDatabase(context), catalog_name)) {
+	}
+
+public:
+	void VisitStatement(SQLStatement &statement) {
+		switch (statement.type) {
+		case StatementType::SELECT_STATEMENT:
+			VisitQueryNode(*statement.Cast<SelectStatement>().node);
+			break;
+		case StatementType::INSERT_STATEMENT: {
+			auto &insert = statement.Cast<InsertStatement>();
+			if (insert.select_statement) {
+				VisitQueryNode(*insert.select_statement->node);
+			}
+			break;
+		}
+		default:
+			// other statements reference at most one table, there is nothing to gain
+			break;
+		}
+	}
+
+public:
+	//! (schema name, table name) pairs, in order of appearance
+	vector<pair<string, string>> tables;
+
+private:
+	void VisitQueryNode(QueryNode &node) {
+		for (auto &cte : node.cte_map.map) {
+			cte_names.insert(cte.first);
+		}
+		ParsedExpressionIterator::EnumerateQueryNodeChildren(
+		    node, [&](unique_ptr<ParsedExpression> &child) { VisitExpression(*child); },
+		    [&](TableRef &ref) { VisitTableRef(ref); });
+	}
+
+	void VisitExpression(ParsedExpression &expr) {
+		if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+			VisitQueryNode(*expr.Cast<SubqueryExpression>().subquery->node);
+		}
+		ParsedExpressionIterator::EnumerateChildren(expr, [&](ParsedExpression &child) { VisitExpression(child); });
+	}
+
+	void VisitTableRef(TableRef &ref) {
+		if (ref.type != TableReferenceType::BASE_TABLE) {
+			return;
+		}
+		auto &table_ref = ref.Cast<BaseTableRef>();
+		if (!table_ref.catalog_name.empty()) {
+			if (StringUtil::CIEquals(table_ref.catalog_name, catalog_name)) {
+				AddTable(table_ref.schema_name.empty() ? default_schema : table_ref.schema_name, table_ref.table_name);
+			}
+			return;
+		}
+		if (!table_ref.schema_name.empty()) {
+			if (StringUtil::CIEquals(table_ref.schema_name, catalog_name)) {
+				// <catalog>.<table>
+				AddTable(default_schema, table_ref.table_name);
+			} else if (is_default_catalog) {
+				AddTable(table_ref.schema_name, table_ref.table_name);
+			}
+			return;
+		}
+		if (is_default_catalog && !cte_names.count(table_ref.table_name)) {
+			AddTable(default_schema, table_ref.table_name);
+		}
+	}
+
+	void AddTable(const string &schema_name, const string &table_name) {
+		tables.emplace_back(schema_name, table_name);
+	}
+
+private:
+	const string catalog_name;
+	const string default_schema;
+	const bool is_default_catalog;
+	case_insensitive_set_t cte_names;
+};
+
+struct PrefetchEntry {
+	explicit PrefetchEntry(shared_ptr<IcebergTable> table) : table(std::move(table)) {
+	}
+
+	shared_ptr<IcebergTable> table;
+	//! Whether the catalog has the table
+	bool exists = false;
+	//! Whether loading the table failed
+	bool failed = false;
+};
+
+} // namespace
+
+void IcebergTablePrefetch::PrefetchQueryTables(ClientContext &context, IcebergCatalog &catalog,
+                                               IcebergTransaction &transaction) {
+	if (!catalog.attach_options.prefetch_tables) {
+		return;
+	}
+	auto query_id = context.transaction.GetActiveQuery();
+	if (transaction.prefetched_query.IsValid() && transaction.prefetched_query.GetIndex() == query_id) {
+		return;
+	}
+	transaction.prefetched_query = query_id;
+	transaction.prefetched_tables.clear();
+
+	auto state = context.registered_state->GetOrCreate<IcebergTablePrefetchState>("iceberg_table_prefetch");
+	auto query = context.GetCurrentQuery();
+	if (state->query != query) {
+		state->query = query;
+		state->statements.clear();
+		state->tables.clear();
+		try {
+			Parser parser(context.GetParserOptions());
+			parser.ParseQuery(query);
+			state->statements = std::move(parser.statements);
+		} catch (std::exception &) {
+			// not something we can parse (e.g. a statement of another extension), the tables are loaded on demand
+		}
+	}
+	auto catalog_name = catalog.GetName().GetIdentifierName();
+	auto tables_entry = state->tables.find(catalog_name);
+	if (tables_entry == state->tables.end()) {
+		TableReferenceCollector collector(context, catalog);
+		for (auto &statement : state->statements) {
+			collector.VisitStatement(*statement);
+		}
+		tables_entry = state->tables.emplace(catalog_name, std::move(collector.tables)).first;
+	}
+
+	vector<PrefetchEntry> entries;
+	case_insensitive_set_t table_keys;
+	for (auto &reference : tables_entry->second) {
+		auto schema_entry = catalog.GetSchemas().GetEntry(context, reference.first, OnEntryNotFound::RETURN_NULL);
+		if (!schema_entry) {
+			continue;
+		}
+		auto &schema = schema_entry->Cast<IcebergSchemaEntry>();
+		auto table_key = IcebergTable::GetTableKey(catalog, schema.namespace_items, reference.second);
+		if (!table_keys.insert(table_key).second || transaction.GetLatestTableState(table_key)) {
+			continue;
+		}
+		if (catalog.attach_options.max_table_staleness_micros.IsValid() &&
+		    catalog.table_request_cache.Get(context, table_key, [](const rest_api_objects::LoadTableResult &) {})) {
+			// the lookup is served from the cache, no round trip to save
+			continue;
+		}
+		entries.emplace_back(make_shared_ptr<IcebergTable>(catalog, schema, reference.second));
+	}
+	if (entries.size() < 2) {
+		return;
+	}
+
+	IcebergUtils::RunIndexedTasks(
+	    context, entries.size(),
+	    [&](idx_t index) {
+		    auto &entry = entries[index];
+		    auto &table = *entry.table;
+		    try {
+			    entry.exists = table.schema.tables.FillEntry(context, table);
+		    } catch (std::exception &) {
+			    // the error is raised again when the binder looks up the table, as it would without prefetching
+			    entry.failed = true;
+		    }
+	    },
+	    IRCAPI::MAX_CONCURRENT_REQUESTS);
+
+	for (auto &entry : entries) {
+		if (entry.failed) {
+			continue;
+		}
+		auto table_key = entry.table->GetTableKey();
+		transaction.prefetched_tables[table_key] = entry.exists ? std::move(entry.table) : nullptr;
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,116 @@
+#include "catalog/rest/iceberg_table_refresher.hpp"
+
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/http_util.hpp"
+#include "duckdb/logging/logger.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+
+#include "catalog/rest/api/catalog_api.hpp"
+#include "catalog/rest/iceberg_catalog.hpp"
+#include "iceberg_logging.hpp"
+
+namespace duckdb {
+
+IcebergTableRefresher::IcebergTableRefresher(IcebergCatalog &catalog)
+    : catalog(catalog), queue(make_shared_ptr<RefreshQueue>()) {
+}
+
+IcebergTableRefresher::~IcebergTableRefresher() {
+	{
+		lock_guard<mutex> guard(queue->lock);
+		queue->shutdown = true;
+		queue->requests.clear();
+	}
+	queue->requests_cv.notify_all();
+	if (!refresh_thread.joinable()) {
+		return;
+	}
+	if (refresh_thread.get_id() == std::this_thread::get_id()) {
+		// The refresh thread released the last reference to the database, it stops once that returns
+		refresh_thread.detach();
+	} else {
+		refresh_thread.join();
+	}
+}
+
+void IcebergTableRefresher::Schedule(ClientContext &context, const string &table_key,
+                                     const vector<string> &namespace_items, const string &table_name,
+                                     optional_ptr<const rest_api_objects::LoadTableResult> source,
+                                     const string &etag) {
+	RefreshRequest request;
+	request.table_key = table_key;
+	request.namespace_items = namespace_items;
+	request.table_name = table_name;
+	request.source = source;
+	request.etag = etag;
+	{
+		lock_guard<mutex> guard(queue->lock);
+		queue->requests.push_back(std::move(request));
+		if (!refresh_thread.joinable()) {
+			// the thread doesn't keep the database alive, the catalog stops it before it is destroyed
+			weak_ptr<DatabaseInstance> db = context.db;
+			refresh_thread = std::thread(Run, std::ref(catalog), std::move(db), queue);
+		}
+	}
+	queue->requests_cv.notify_one();
+}
+
+void IcebergTableRefresher::Run(IcebergCatalog &catalog, weak_ptr<DatabaseInstance> db,
+                                shared_ptr<RefreshQueue> queue) {
+	while (true) {
+		RefreshRequest request;
+		{
+			unique_lock<mutex> guard(queue->lock);
+			queue->requests_cv.wait(guard, [&]() { return queue->shutdown || !queue->requests.empty(); });
+			if (queue->shutdown) {
+				return;
+			}
+			request = std::move(queue->requests.front());
+			queue->requests.pop_front();
+		}
+		auto instance = db.lock();
+		if (!instance) {
+			// the database is shutting down
+			return;
+		}
+		Refresh(catalog, *instance, request);
+		// This can be the last reference to the database, after releasing it 'catalog' may no longer exist
+		instance.reset();
+	}
+}
+
+void IcebergTableRefresher::Refresh(IcebergCatalog &catalog, DatabaseInstance &db, const RefreshRequest &request) {
+	auto &cache = catalog.table_request_cache;
+	auto source = request.source;
+	Connection connection(db);
+	auto &context = *connection.context;
+	try {
+		context.RunFunctionInTransaction([&]() {
+			DUCKDB_LOG(context, IcebergLogType, "Refreshing the metadata of table %s in the background",
+			           request.table_key);
+			auto result =
+			    IRCAPI::GetTable(context, catalog, request.namespace_items, request.table_name, request.etag);
+			if (result.status_ == HTTPStatusCode::NotModified_304) {
+				cache.FinishRefresh(request.table_key, source, true);
+				return;
+			}
+			if (result.error_) {
+				// The table is reloaded by the first query that finds the cached metadata stale
+				DUCKDB_LOG_WARNING(context, "Background refresh of table %s returned response code %s: %s",
+				                   request.table_key, EnumUtil::ToString(result.status_),
+				                   result.error_->_error.message);
+				cache.FinishRefresh(request.table_key, source, false);
+				return;
+			}
+			cache.FinishRefresh(request.table_key, source, true, std::move(result.result_), result.etag_);
+		});
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		DUCKDB_LOG_WARNING(context, "Background refresh of table %s failed: %s", request.table_key,
+		                   error.RawMessage());
+		cache.FinishRefresh(request.table_key, source, false);
+	}
+}
+
+} // namespace duckdb
@@ -10,10 +10,12 @@
 #include "duckdb/planner/tableref/bound_at_clause.hpp"
 #include "duckdb/planner/expression_binder/table_function_binder.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include "catalog/rest/api/catalog_api.hpp"
 #include "catalog/rest/api/catalog_utils.hpp"
 #include "catalog/rest/iceberg_catalog.hpp"
+#include "catalog/rest/iceberg_table_prefetch.hpp"
 #include "catalog/rest/catalog_entry/table/iceberg_table_schema_version.hpp"
 #include "catalog/rest/transaction/iceberg_transaction.hpp"
 #include "catalog/rest/storage/authorization/sigv4.hpp"
@@ -45,12 +47,35 @@ bool IcebergTableSet::FillEntry(ClientContext &context, IcebergTable &table) {
 			    table.InitializeFromLoadTableResult(cached_result);
 		    });
 		if (cache_hit) {
+			// Past TABLE_REFRESH_AFTER the cached result is still used, but renewed in the background
+			string cached_etag;
+			auto cached_result = ic_catalog.table_request_cache.ClaimRefresh(table_key, cached_etag);
+			if (cached_result) {
+				ic_catalog.table_refresher.Schedule(context, table_key, schema.namespace_items, table.name,
+				                                    cached_result, cached_etag);
+			}
 			return true;
 		}
 	}
 
 	// No valid cached result or caching disabled, make a new request
-	auto get_table_result = IRCAPI::GetTable(context, ic_catalog, schema, table.name);
+	string cached_etag;
+	if (ic_catalog.attach_options.max_table_staleness_micros.IsValid()) {
+		// An expired result can still be current, let the catalog tell us through its ETag
+		cached_etag = ic_catalog.table_request_cache.GetETag(table_key);
+	}
+	auto get_table_result = IRCAPI::GetTable(context, ic_catalog, schema, table.name, cached_etag);
+	if (get_table_result.status_ == HTTPStatusCode::NotModified_304) {
+		auto revalidated = ic_catalog.table_request_cache.Revalidate(
+		    table_key, cached_etag, [&](const rest_api_objects::LoadTableResult &cached_result) {
+			    table.InitializeFromLoadTableResult(cached_result);
+		    });
+		if (revalidated) {
+			return true;
+		}
+		// The cached result was replaced while we revalidated it, load the table in full
+		get_table_result = IRCAPI::GetTable(context, ic_catalog, schema, table.name);
+	}
 	if (get_table_result.error_) {
 		if (get_table_result.status_ == HTTPStatusCode::NotFound_404) {
 			// Glue returns 404 when a table is not an Iceberg Table with the error message
@@ -70,7 +95,8 @@ bool IcebergTableSet::FillEntry(ClientContext &context, IcebergTable &table) {
 	}
 	auto &load_table_result = *get_table_result.result_;
 	table.InitializeFromLoadTableResult(load_table_result);
-	ic_catalog.table_request_cache.SetOrOverwrite(table_key, std::move(get_table_result.result_));
+	ic_catalog.table_request_cache.SetOrOverwrite(table_key, std::move(get_table_result.result_),
+	                                              get_table_result.etag_);
 	return true;
 }
 
@@ -177,7 +203,38 @@ void IcebergTableSet::LoadEntriesInternal(ClientContext &context) {
 		return;
 	}
 	auto &ic_catalog = catalog.Cast<IcebergCatalog>();
-	auto tables = IRCAPI::GetTables(context, ic_catalog, schema);
+	optional<vector<rest_api_objects::TableIdentifier>> tables;
+	auto prefetched = iceberg_transaction.prefetched_listings.find(schema.name.GetIdentifierName());
+	if (prefetched != iceberg_transaction.prefetched_listings.end()) {
+		tables = std::move(prefetched->second);
+		iceberg_transaction.prefetched_listings.erase(prefetched);
+	} else if (iceberg_transaction.called_list_schemas) {
+		// The transaction listed all schemas, it's likely walking over all of them (e.g. SHOW ALL TABLES or
+		// information_schema): list the tables of the next few schemas it hasn't listed yet concurrently. The batch
+		// is bounded, so a lookup in one schema of a catalog with many namespaces doesn't list all of them.
+		auto batch_size = MinValue<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads(),
+		                                  IRCAPI::MAX_CONCURRENT_REQUESTS);
+		vector<reference<IcebergSchemaEntry>> schemas {schema};
+		for (auto &entry : iceberg_transaction.schemas) {
+			if (schemas.size() >= batch_size) {
+				break;
+			}
+			auto &other = *entry.second;
+			if (&other == &schema || !other.DoesExist() || iceberg_transaction.deleted_schemas.count(entry.first) ||
+			    iceberg_transaction.listed_schemas.count(entry.first) ||
+			    iceberg_transaction.prefetched_listings.count(entry.first)) {
+				continue;
+			}
+			schemas.push_back(other);
+		}
+		auto listings = IRCAPI::GetTables(context, ic_catalog, schemas);
+		tables = std::move(listings[0]);
+		for (idx_t i = 1; i < schemas.size(); i++) {
+			iceberg_transaction.prefetched_listings[schemas[i].get().name.GetIdentifierName()] = std::move(listings[i]);
+		}
+	} else {
+		tables = IRCAPI::GetTables(context, ic_catalog, schema);
+	}
 	// A refused listing says nothing about which tables exist, so the cache is left untouched.
 	if (tables) {
 		case_insensitive_set_t listed;
@@ -328,6 +385,18 @@ IcebergTable &IcebergTableSet::CreateNewEntry(ClientContext &context, IcebergCat
 	return table_info;
 }
 
+//! The entry of the table at 'at'. Time travel can need snapshots that SNAPSHOT_LOADING_MODE 'refs' left out, these
+//! are loaded into the transaction's own copy of the table.
+static optional_ptr<CatalogEntry> GetTableVersion(ClientContext &context, IcebergTransaction &transaction,
+                                                  IcebergTransactionTableState &state, optional_ptr<BoundAtClause> at) {
+	if (at && !state.GetInfo().has_all_snapshots) {
+		auto &table_info = state.GetOrCreateTransactionInfo(transaction);
+		table_info.LoadAllSnapshots(context);
+		return table_info.GetSchemaVersion(at);
+	}
+	return state.GetInfo().GetSchemaVersion(at);
+}
+
 optional_ptr<CatalogEntry> IcebergTableSet::GetEntry(ClientContext &context, const EntryLookupInfo &lookup) {
 	auto &ic_catalog = catalog.Cast<IcebergCatalog>();
 	auto &iceberg_transaction = IcebergTransaction::Get(context, catalog);
@@ -346,10 +415,27 @@ optional_ptr<CatalogEntry> IcebergTableSet::GetEntry(ClientContext &context, con
 		if (table_info.schema_versions.empty()) {
 			table_info.InitSchemaVersions();
 		}
-		return table_info.GetSchemaVersion(at);
+		return GetTableVersion(context, iceberg_transaction, *latest_state, at);
 	}
 
-	auto new_version = make_shared_ptr<IcebergTable>(ic_catalog, schema, table_name);
+	IcebergTablePrefetch::PrefetchQueryTables(context, ic_catalog, iceberg_transaction);
+	shared_ptr<IcebergTable> new_version;
+	auto prefetched = iceberg_transaction.prefetched_tables.find(table_key);
+	if (prefetched != iceberg_transaction.prefetched_tables.end()) {
+		if (!prefetched->second) {
+			//! The prefetch found that the table doesn't exist in the catalog
+			iceberg_transaction.prefetched_tables.erase(prefetched);
+			iceberg_transaction.SetLatestTableState(table_key, IcebergTableStatus::MISSING);
+			return nullptr;
+		}
+		if (&prefetched->second->schema == &schema) {
+			new_version = std::move(prefetched->second);
+		}
+		iceberg_transaction.prefetched_tables.erase(prefetched);
+	}
+	if (!new_version) {
+		new_version = make_shared_ptr<IcebergTable>(ic_catalog, schema, table_name);
+	}
 	auto &table_info = *new_version;
 	if (!FillEntry(context, table_info)) {
 		//! The table doesn't exist in the catalog
@@ -366,7 +452,7 @@ optional_ptr<CatalogEntry> IcebergTableSet::GetEntry(ClientContext &context, con
 	if (iceberg_transaction.StartedBefore(table_info.table_metadata.last_updated_ms)) {
 		state.GetOrCreateTransactionInfo(iceberg_transaction);
 	}
-	return state.GetInfo().GetSchemaVersion(at);
+	return GetTableVersion(context, iceberg_transaction, state, at);
 }
 
 } // namespace duckdb
@@ -0,0 +1,121 @@
+#include "catalog/rest/transaction/iceberg_group_commit.hpp"
+
+#include "duckdb/logging/logger.hpp"
+#include "duckdb/main/client_context.hpp"
+
+#include <chrono>
+
+#include "catalog/rest/catalog_entry/table/iceberg_table.hpp"
+#include "catalog/rest/transaction/iceberg_transaction_data.hpp"
+#include "iceberg_logging.hpp"
+
+namespace duckdb {
+
+IcebergGroupCommitCoordinator::IcebergGroupCommitCoordinator(optional_idx window_micros)
+    : window_micros(window_micros) {
+}
+
+void IcebergGroupCommitCoordinator::Commit(ClientContext &context, IcebergTable &table,
+                                           const std::function<void()> &commit) {
+	D_ASSERT(table.transaction_data);
+	auto table_key = table.GetTableKey();
+	shared_ptr<CommitGroup> group;
+	{
+		unique_lock<mutex> guard(lock);
+		RemovePendingCommitInternal(table_key);
+		auto it = open_groups.find(table_key);
+		if (it == open_groups.end()) {
+			group = make_shared_ptr<CommitGroup>(table);
+			open_groups.emplace(table_key, group);
+		} else if (it->second->leader.get().transaction_data->CanCombineAppends(*table.transaction_data)) {
+			//! Join the open group, the leader commits our appends
+			auto joined_group = it->second;
+			joined_group->members.push_back(table);
+			joined_group->joined_cv.notify_all();
+			joined_group->finished_cv.wait(guard, [&]() { return joined_group->finished; });
+			if (joined_group->error.HasError()) {
+				joined_group->error.Throw();
+			}
+			return;
+		}
+	}
+	if (!group) {
+		//! The open group was started against a different version of the table, commit on our own
+		commit();
+		return;
+	}
+
+	// Test hook to hold the leader until the given number of transactions are in its group, regardless of the window
+	Value group_size;
+	idx_t min_group_size = 0;
+	if (context.TryGetCurrentSetting("iceberg_test_group_commit_size", group_size) && !group_size.IsNull()) {
+		min_group_size = group_size.GetValue<idx_t>();
+	}
+	vector<reference<IcebergTable>> members;
+	{
+		unique_lock<mutex> guard(lock);
+		if (min_group_size > 0) {
+			group->joined_cv.wait(guard, [&]() { return group->members.size() + 1 >= min_group_size; });
+		} else {
+			//! Wait for the window to pass, or until no other transaction has staged changes to the table
+			group->joined_cv.wait_for(guard, std::chrono::microseconds(window_micros.GetIndex()),
+			                          [&]() { return pending_commits.find(table_key) == pending_commits.end(); });
+		}
+		open_groups.erase(table_key);
+		members = group->members;
+	}
+
+	ErrorData error;
+	try {
+		auto &transaction_data = *table.transaction_data;
+		for (auto &member : members) {
+			transaction_data.CombineAppends(*member.get().transaction_data);
+		}
+		DUCKDB_LOG(context, IcebergLogType, "phase=group_commit table=%s transactions=%llu", table_key,
+		           members.size() + 1);
+		// Test hook to fail the commit of the whole group
+		Value fail_commit;
+		if (context.TryGetCurrentSetting("iceberg_test_fail_group_commit", fail_commit) && !fail_commit.IsNull() &&
+		    fail_commit.GetValue<bool>()) {
+			throw IOException("Group commit of table %s failed (iceberg_test_fail_group_commit)", table_key);
+		}
+		commit();
+	} catch (std::exception &ex) {
+		error = ErrorData(ex);
+	}
+	{
+		lock_guard<mutex> guard(lock);
+		group->finished = true;
+		group->error = error;
+	}
+	group->finished_cv.notify_all();
+	if (error.HasError()) {
+		error.Throw();
+	}
+}
+
+void IcebergGroupCommitCoordinator::AddPendingCommit(const string &table_key) {
+	lock_guard<mutex> guard(lock);
+	pending_commits[table_key]++;
+}
+
+void IcebergGroupCommitCoordinator::RemovePendingCommit(const string &table_key) {
+	lock_guard<mutex> guard(lock);
+	RemovePendingCommitInternal(table_key);
+}
+
+void IcebergGroupCommitCoordinator::RemovePendingCommitInternal(const string &table_key) {
+	auto it = pending_commits.find(table_key);
+	if (it == pending_commits.end()) {
+		return;
+	}
+	if (--it->second == 0) {
+		pending_commits.erase(it);
+	}
+	auto group = open_groups.find(table_key);
+	if (group != open_groups.end()) {
+		group->second->joined_cv.notify_all();
+	}
+}
+
+} // namespace duckdb
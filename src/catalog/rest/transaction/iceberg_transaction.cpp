@@ -33,6 +33,7 @@
 #include "iceberg_logging.hpp"
 #include "catalog/rest/api/table_update.hpp"
 #include "catalog/rest/transaction/iceberg_transaction_update.hpp"
+#include "catalog/rest/transaction/iceberg_group_commit.hpp"
 #include "rest_catalog/objects/list.hpp"
 
 namespace duckdb {
@@ -71,7 +72,11 @@ IcebergTransaction::IcebergTransaction(IcebergCatalog &ic_catalog, TransactionMa
     : Transaction(manager, context), db(*context.db), catalog(ic_catalog), access_mode(ic_catalog.access_mode) {
 }
 
-IcebergTransaction::~IcebergTransaction() = default;
+IcebergTransaction::~IcebergTransaction() {
+	for (auto &table_key : pending_group_commits) {
+		catalog.group_commit.RemovePendingCommit(table_key);
+	}
+}
 
 void IcebergTransaction::Start() {
 }
@@ -394,6 +399,28 @@ void IcebergTransaction::VerifyAlterUpdateAtomicity(const IcebergTransactionAlte
 	                           "require multiple table commit requests without atomic multi-table commit support");
 }
 
+optional_ptr<IcebergTable> IcebergTransaction::GetGroupCommitTable(IcebergTransactionAlterUpdate &alter_update) {
+	if (!catalog.group_commit.Enabled()) {
+		return nullptr;
+	}
+	optional_ptr<IcebergTable> result;
+	for (auto &entry : alter_update.updated_tables) {
+		auto &table_info = entry.second.get();
+		if (!table_info.HasTransactionUpdates()) {
+			continue;
+		}
+		if (result) {
+			//! Only single-table appends are grouped
+			return nullptr;
+		}
+		result = table_info;
+	}
+	if (!result || !result->transaction_data->OnlyAppends()) {
+		return nullptr;
+	}
+	return result;
+}
+
 bool IcebergTransaction::MultiTableCommitAvailable() const {
 	return !catalog.attach_options.disable_multi_table_commit &&
 	       catalog.supported_urls.count("POST /v1/{prefix}/transactions/commit");
@@ -537,10 +564,20 @@ void IcebergTransaction::DoTableUpdates(IcebergTransactionAlterUpdate &alter_upd
 	if (!alter_update.HasUpdates()) {
 		return;
 	}
-	if (CanUseMultiTableCommit(alter_update)) {
-		DoMultiTableCommitUpdates(alter_update, context);
+	auto commit_updates = [&]() {
+		if (CanUseMultiTableCommit(alter_update)) {
+			DoMultiTableCommitUpdates(alter_update, context);
+		} else {
+			DoSingleTableCommitUpdates(alter_update, context);
+		}
+	};
+	auto group_commit_table = GetGroupCommitTable(alter_update);
+	if (group_commit_table) {
+		//! The coordinator stops counting the table as pending once we reach it
+		pending_group_commits.erase(group_commit_table->GetTableKey());
+		catalog.group_commit.Commit(context, *group_commit_table, commit_updates);
 	} else {
-		DoSingleTableCommitUpdates(alter_update, context);
+		commit_updates();
 	}
 
 	auto &ic_catalog = catalog.Cast<IcebergCatalog>();
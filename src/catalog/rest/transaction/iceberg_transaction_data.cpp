@@ -17,6 +17,21 @@
 
 namespace duckdb {
 
+string IcebergManifestDeletes::GetKey(const IcebergDataFile &data_file) {
+	if (!data_file.IsDeletionVector()) {
+		return data_file.file_path;
+	}
+	return data_file.file_path + "#" + std::to_string(*data_file.content_offset);
+}
+
+void IcebergManifestDeletes::InvalidateEntry(const IcebergDataFile &data_file, const IcebergManifestFile &manifest) {
+	InvalidatedFile file;
+	file.is_delete_file = data_file.content != IcebergManifestEntryContentType::DATA;
+	file.manifest_path = manifest.manifest_path;
+	file.partition = IcebergPartition {manifest.partition_spec_id, data_file.partition_info};
+	data_files.emplace(GetKey(data_file), std::move(file));
+}
+
 static void LoadMissingManifestCounts(ClientContext &context, const IcebergTableMetadata &metadata,
                                       const IcebergSnapshotScanInfo &snapshot_info,
                                       IcebergManifestListEntry &manifest_list_entry) {
@@ -138,8 +153,49 @@ bool IcebergTransactionData::ContainsDelete() const {
 	return false;
 }
 
-bool IcebergTransactionData::IsFileInvalidated(const string &file_path) const {
-	return manifest_deletes.IsInvalidated(file_path);
+bool IcebergTransactionData::IsFileInvalidated(const IcebergDataFile &data_file) const {
+	return manifest_deletes.IsInvalidated(data_file);
+}
+
+bool IcebergTransactionData::OnlyAppends() const {
+	if (has_assert_create || !requirements.empty() || pending_current_schema_id.has_value()) {
+		return false;
+	}
+	if (updates.empty()) {
+		return false;
+	}
+	for (auto &update : updates) {
+		if (update->type != IcebergTableUpdateType::ADD_SNAPSHOT) {
+			return false;
+		}
+		if (update->Cast<IcebergAddSnapshot>().GetOperation() != IcebergSnapshotOperationType::APPEND) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool IcebergTransactionData::CanCombineAppends(const IcebergTransactionData &other) const {
+	if (!OnlyAppends() || !other.OnlyAppends()) {
+		return false;
+	}
+	if (table_info.table_metadata.iceberg_version != other.table_info.table_metadata.iceberg_version) {
+		return false;
+	}
+	//! The manifests of 'other' are written against the table as it was when it started, which has to be the same
+	//! table, schema, partition spec and sort order this transaction commits against
+	return other.RetryStateMatches(table_info);
+}
+
+void IcebergTransactionData::CombineAppends(const IcebergTransactionData &other) {
+	D_ASSERT(CanCombineAppends(other));
+	lock_guard<mutex> guard(lock);
+	auto &target = alters.back().get();
+	for (auto &alter : other.alters) {
+		for (auto &manifest_file : alter.get().GetManifestFiles()) {
+			target.AddManifestFile(IcebergManifestListEntry(manifest_file));
+		}
+	}
 }
 
 bool IcebergTransactionData::SupportsAppendRetry() const {
@@ -227,16 +283,16 @@ void IcebergTransactionData::AddSnapshot(IcebergSnapshotOperationType operation,
 	AddSnapshotUpdate(std::move(add_snapshot), std::move(altered_manifests));
 }
 
-void IcebergTransactionData::AddDeleteManifestFiles(IcebergAddSnapshot &add_snapshot,
-                                                    partitioned_manifest_entry_map_t &&delete_files,
-                                                    sequence_number_t sequence_number) {
+void IcebergTransactionData::AddPartitionedManifestFiles(IcebergAddSnapshot &add_snapshot,
+                                                         IcebergManifestContentType content,
+                                                         partitioned_manifest_entry_map_t &&entries,
+                                                         sequence_number_t sequence_number) {
 	auto &table_metadata = table_info.table_metadata;
 	auto &fs = FileSystem::GetFileSystem(context);
 	//! One manifest per partition spec: a manifest declares a single spec, and the entries it holds carry
 	//! partition values in that spec.
-	for (auto &entry : delete_files) {
-		auto manifest_metadata =
-		    IcebergManifestMetadata::FromTableMetadata(table_metadata, IcebergManifestContentType::DELETE, entry.first);
+	for (auto &entry : entries) {
+		auto manifest_metadata = IcebergManifestMetadata::FromTableMetadata(table_metadata, content, entry.first);
 		add_snapshot.AddManifestFile(IcebergManifestListEntry::CreateFromEntries(
 		    fs, sequence_number, table_metadata, manifest_metadata, std::move(entry.second), next_row_id));
 	}
@@ -263,7 +319,8 @@ void IcebergTransactionData::AddDeleteSnapshot(partitioned_manifest_entry_map_t
 	const auto sequence_number = table_metadata.last_sequence_number + alters.size() + 1;
 
 	auto add_snapshot = make_uniq<IcebergAddSnapshot>(table_info, IcebergSnapshotOperationType::DELETE);
-	AddDeleteManifestFiles(*add_snapshot, std::move(delete_files), sequence_number);
+	AddPartitionedManifestFiles(*add_snapshot, IcebergManifestContentType::DELETE, std::move(delete_files),
+	                            sequence_number);
 	// make sure we are still inserting into the current schema
 	if (table_metadata.current_snapshot_id) {
 		TableAddAssertCurrentSchemaId();
@@ -273,7 +330,8 @@ void IcebergTransactionData::AddDeleteSnapshot(partitioned_manifest_entry_map_t
 
 void IcebergTransactionData::AddUpdateSnapshot(partitioned_manifest_entry_map_t &&delete_files,
                                                vector<IcebergManifestEntry> &&data_files,
-                                               IcebergManifestDeletes &&altered_manifests) {
+                                               IcebergManifestDeletes &&altered_manifests,
+                                               partitioned_manifest_entry_map_t &&rewritten_files) {
 	//! NOTE: Lock has to be held to make sure the rows are assigned the correct row ids
 	lock_guard<mutex> guard(lock);
 
@@ -290,13 +348,39 @@ void IcebergTransactionData::AddUpdateSnapshot(partitioned_manifest_entry_map_t
 	    IcebergManifestMetadata::FromTableMetadata(table_metadata, IcebergManifestContentType::DATA);
 
 	auto add_snapshot = make_uniq<IcebergAddSnapshot>(table_info);
-	AddDeleteManifestFiles(*add_snapshot, std::move(delete_files), sequence_number);
+	AddPartitionedManifestFiles(*add_snapshot, IcebergManifestContentType::DELETE, std::move(delete_files),
+	                            sequence_number);
+	//! Copy-on-write: the rewritten data files keep the partition spec of the files they replace
+	AddPartitionedManifestFiles(*add_snapshot, IcebergManifestContentType::DATA, std::move(rewritten_files),
+	                            sequence_number);
 	// Add a manifest_file for the new insert data
 	add_snapshot->AddManifestFile(IcebergManifestListEntry::CreateFromEntries(
 	    fs, sequence_number, table_metadata, data_manifest_metadata, std::move(data_files), next_row_id));
 	AddSnapshotUpdate(std::move(add_snapshot), std::move(altered_manifests));
 }
 
+void IcebergTransactionData::AddOverwriteSnapshot(partitioned_manifest_entry_map_t &&rewritten_files,
+                                                  IcebergManifestDeletes &&altered_manifests) {
+	//! NOTE: Lock has to be held to make sure the rows are assigned the correct row ids
+	lock_guard<mutex> guard(lock);
+
+	auto &table_metadata = table_info.table_metadata;
+	CacheExistingManifestList(guard, table_metadata);
+
+	const auto sequence_number = table_metadata.last_sequence_number + alters.size() + 1;
+
+	//! Every row of a data file can be deleted, in which case there is no rewritten file and the snapshot only
+	//! removes data files
+	auto add_snapshot = make_uniq<IcebergAddSnapshot>(table_info, IcebergSnapshotOperationType::OVERWRITE);
+	AddPartitionedManifestFiles(*add_snapshot, IcebergManifestContentType::DATA, std::move(rewritten_files),
+	                            sequence_number);
+	// make sure we are still inserting into the current schema
+	if (table_metadata.current_snapshot_id) {
+		TableAddAssertCurrentSchemaId();
+	}
+	AddSnapshotUpdate(std::move(add_snapshot), std::move(altered_manifests));
+}
+
 void IcebergTransactionData::TableAddSchema(int32_t schema_id) {
 	auto schema = table_info.table_metadata.GetSchemaFromId(schema_id);
 	if (!schema) {
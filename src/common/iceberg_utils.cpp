@@ -9,6 +9,7 @@
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/common/operator/add.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 
 #include "catalog/rest/catalog_entry/table/iceberg_table_schema_version.hpp"
 #include "catalog/rest/catalog_entry/table/iceberg_table.hpp"
@@ -35,6 +36,60 @@ timestamp_ms_t IcebergUtils::GetTransactionStartTimeMS(ClientContext &context) {
 	return timestamp_ms_t(Timestamp::GetEpochMs(transaction_start));
 }
 
+namespace {
+
+//! Runs 'function' for every index below 'count' until there are none left, multiple tasks share 'next_index'
+class IndexedTask : public BaseExecutorTask {
+public:
+	IndexedTask(TaskExecutor &executor, idx_t count, atomic<idx_t> &next_index,
+	            const std::function<void(idx_t)> &function)
+	    : BaseExecutorTask(executor), count(count), next_index(next_index), function(function) {
+	}
+
+	void ExecuteTask() override {
+		while (!executor.HasError()) {
+			auto index = next_index++;
+			if (index >= count) {
+				break;
+			}
+			function(index);
+		}
+	}
+
+	string TaskType() const override {
+		return "IcebergIndexedTask";
+	}
+
+private:
+	idx_t count;
+	atomic<idx_t> &next_index;
+	const std::function<void(idx_t)> &function;
+};
+
+} // namespace
+
+void IcebergUtils::RunIndexedTasks(ClientContext &context, idx_t count, const std::function<void(idx_t)> &function,
+                                   optional_idx max_tasks) {
+	if (count == 0) {
+		return;
+	}
+	if (count == 1) {
+		function(0);
+		return;
+	}
+	TaskExecutor executor(context);
+	atomic<idx_t> next_index {0};
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto num_tasks = MinValue<idx_t>(scheduler.NumberOfThreads(), count);
+	if (max_tasks.IsValid()) {
+		num_tasks = MinValue<idx_t>(num_tasks, max_tasks.GetIndex());
+	}
+	for (idx_t i = 0; i < num_tasks; i++) {
+		executor.ScheduleTask(make_uniq<IndexedTask>(executor, count, next_index, function));
+	}
+	executor.WorkOnTasks();
+}
+
 idx_t IcebergUtils::ParseByteSizeOptionallyFormatted(const string &input) {
 	idx_t result;
 	auto error = StringUtil::TryParseFormattedBytes(input, result);
@@ -238,8 +293,14 @@ IcebergResolvedMetadata IcebergUtils::ResolveTableMetadata(ClientContext &contex
 
 			auto &iceberg_table = catalog_entry->Cast<IcebergTableSchemaVersion>();
 			iceberg_table.PrepareIcebergScanFromEntry(context);
-			auto &metadata = iceberg_table.table_info.table_metadata;
-			return IcebergResolvedMetadata(metadata.GetLocation(), metadata.Copy());
+			auto &table_info = iceberg_table.table_info;
+			auto metadata = table_info.table_metadata.Copy();
+			if (!options.snapshot_lookup || !options.snapshot_lookup->IsLatest()) {
+				// listing or selecting past snapshots needs the ones a reference-only load left out
+				table_info.LoadAllSnapshots(context, metadata);
+			}
+			auto location = metadata.GetLocation();
+			return IcebergResolvedMetadata(std::move(location), std::move(metadata));
 		}
 	}
 
@@ -1,6 +1,7 @@
 #include "core/deletes/iceberg_deletion_vector.hpp"
 
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/bswap.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/string_util.hpp"
@@ -132,14 +133,55 @@ shared_ptr<IcebergDeletionVectorData> IcebergDeletionVectorData::FromBlob(const
 	return result_p;
 }
 
+namespace {
+
+//! One bit per row of a vector, set when the row is deleted
+struct DeletedRowMask {
+	static constexpr idx_t BITS_PER_WORD = 64;
+	static constexpr idx_t WORD_COUNT = (STANDARD_VECTOR_SIZE + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+	void SetDeleted(idx_t row) {
+		words[row / BITS_PER_WORD] |= uint64_t(1) << (row % BITS_PER_WORD);
+	}
+
+	uint64_t words[WORD_COUNT] = {};
+};
+
+//! Mark the positions of 'bitmap' that fall inside [offset, next_offset) of the vector starting at 'low_start'
+static void MarkDeletedRows(const roaring::Roaring &bitmap, uint32_t low_start, idx_t offset, idx_t next_offset,
+                            DeletedRowMask &mask) {
+	const idx_t range_size = next_offset - offset;
+	roaring::api::roaring_uint32_iterator_t iterator;
+	roaring::api::roaring_iterator_init(&bitmap.roaring, &iterator);
+	if (!roaring::api::roaring_uint32_iterator_move_equalorlarger(&iterator, low_start)) {
+		return;
+	}
+	//! The range holds at most 'range_size' distinct positions, so a single bulk read covers all of them
+	uint32_t positions[STANDARD_VECTOR_SIZE];
+	auto read_count =
+	    roaring::api::roaring_uint32_iterator_read(&iterator, positions, NumericCast<uint32_t>(range_size));
+	for (uint32_t i = 0; i < read_count; i++) {
+		const idx_t relative_position = positions[i] - low_start;
+		if (relative_position >= range_size) {
+			break;
+		}
+		mask.SetDeleted(offset + relative_position);
+	}
+}
+
+} // namespace
+
 idx_t IcebergDeletionVector::Filter(row_t start_row_index, idx_t count, SelectionVector &result_sel) {
+	//! All cursor state lives on the stack of this call, the shared bitmaps are only ever read, so any
+	//! number of scan threads can filter (row groups of) the same data file without synchronization.
 	if (count == 0) {
 		return 0;
 	}
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
 	result_sel.Initialize(STANDARD_VECTOR_SIZE);
-	idx_t selection_idx = 0;
 
-	auto &bitmaps = data->bitmaps;
+	DeletedRowMask mask;
+	bool has_deletes = false;
 	idx_t offset = 0;
 	while (offset < count) {
 		const row_t current_row = start_row_index + offset;
@@ -149,53 +191,61 @@ idx_t IcebergDeletionVector::Filter(row_t start_row_index, idx_t count, Selectio
 		//! FIXME: How do we test this? These offsets are **huge**
 		const idx_t next_offset = MinValue<idx_t>(start_row_index + count, next_high_boundary) - start_row_index;
 
-		lock_guard<mutex> guard(lock);
-		//! Update the state
-		if (!current_high || *current_high != high) {
-			auto it = bitmaps.find(high);
-			if (it == bitmaps.end()) {
-				current_bitmap = nullptr;
-			} else {
-				current_bitmap = it->second;
-				bulk_context = roaring::BulkContext();
-			}
-			current_high = high;
+		auto it = bitmaps.find(high);
+		if (it != bitmaps.end()) {
+			const uint32_t low_start = static_cast<uint32_t>(current_row & 0xFFFFFFFF);
+			MarkDeletedRows(it->second, low_start, offset, next_offset, mask);
+			has_deletes = true;
 		}
+		offset = next_offset;
+	}
 
-		if (!current_bitmap) {
-			for (idx_t i = offset; i < next_offset; ++i) {
-				result_sel.set_index(selection_idx++, i);
-			}
-		} else {
-			const roaring::Roaring &bitmap = *current_bitmap;
-			for (idx_t i = offset; i < next_offset; ++i) {
-				uint32_t low_bits = static_cast<uint32_t>((start_row_index + i) & 0xFFFFFFFF);
-				const bool is_deleted = bitmap.containsBulk(bulk_context, low_bits);
-				result_sel.set_index(selection_idx, i);
-				selection_idx += !is_deleted;
-			}
+	idx_t selection_idx = 0;
+	if (!has_deletes) {
+		for (idx_t i = 0; i < count; i++) {
+			result_sel.set_index(selection_idx++, i);
 		}
+		return selection_idx;
+	}
 
-		offset = next_offset;
+	//! Convert the mask to a selection vector one word (64 rows) at a time
+	for (idx_t word_idx = 0; word_idx * DeletedRowMask::BITS_PER_WORD < count; word_idx++) {
+		const idx_t word_start = word_idx * DeletedRowMask::BITS_PER_WORD;
+		const idx_t rows_in_word = MinValue<idx_t>(DeletedRowMask::BITS_PER_WORD, count - word_start);
+		const uint64_t word_rows =
+		    rows_in_word == DeletedRowMask::BITS_PER_WORD ? ~uint64_t(0) : (uint64_t(1) << rows_in_word) - 1;
+		uint64_t valid = ~mask.words[word_idx] & word_rows;
+		if (valid == word_rows) {
+			for (idx_t i = 0; i < rows_in_word; i++) {
+				result_sel.set_index(selection_idx++, word_start + i);
+			}
+			continue;
+		}
+		while (valid) {
+			const idx_t bit = CountZeros<uint64_t>::Trailing(valid);
+			result_sel.set_index(selection_idx++, word_start + bit);
+			valid &= valid - 1;
+		}
 	}
 	return selection_idx;
 }
 
 unique_ptr<DeleteFilter> IcebergDeletionVectorData::ToFilter() const {
-	return make_uniq<IcebergDeletionVector>(shared_from_this());
+	return make_uniq<IcebergDeletionVector>(shared_from_this(), bitmaps);
 }
 
 namespace {
 
 struct RoaringIterateContext {
-	set<idx_t> *out;
+	vector<idx_t> *out;
 	idx_t high;
 };
 
 } // namespace
 
-void IcebergDeletionVectorData::ToSet(set<idx_t> &out) const {
+void IcebergDeletionVectorData::AppendBitmapPositions(const deletion_bitmap_map_t &bitmaps, vector<idx_t> &out) {
 	for (auto &entry : bitmaps) {
+		out.reserve(out.size() + entry.second.cardinality());
 		RoaringIterateContext ctx {&out, static_cast<idx_t>(entry.first)};
 		auto &bitmap = entry.second;
 
@@ -203,14 +253,18 @@ void IcebergDeletionVectorData::ToSet(set<idx_t> &out) const {
 		    [](uint32_t value, void *ptr) -> bool {
 			    auto *ctx = static_cast<RoaringIterateContext *>(ptr);
 			    idx_t full_value = (ctx->high << 32) | static_cast<idx_t>(value);
-			    ctx->out->insert(full_value);
+			    ctx->out->push_back(full_value);
 			    return true;
 		    },
 		    &ctx);
 	}
 }
 
-vector<data_t> IcebergDeletionVectorData::ToBlob(const unordered_map<int32_t, roaring::Roaring> &bitmaps) {
+void IcebergDeletionVectorData::AppendPositions(vector<idx_t> &out) const {
+	AppendBitmapPositions(bitmaps, out);
+}
+
+vector<data_t> IcebergDeletionVectorData::ToBlob(const deletion_bitmap_map_t &bitmaps) {
 	//! https://iceberg.apache.org/puffin-spec/#deletion-vector-v1-blob-type
 
 	// Calculate total size needed
@@ -261,40 +315,45 @@ vector<data_t> IcebergDeletionVectorData::ToBlob(const unordered_map<int32_t, ro
 	return blob_output;
 }
 
-vector<data_t> IcebergDeletionVectorData::ToPuffinFile(const vector<data_t> &blob, const string &referenced_data_file,
-                                                       idx_t cardinality) {
-	//! Wrap a `deletion-vector-v1` blob in a valid Puffin file container.
+vector<data_t> IcebergDeletionVectorData::ToPuffinFile(vector<IcebergDeletionVectorBlob> &blobs) {
+	//! Wrap `deletion-vector-v1` blobs in a valid Puffin file container.
 	//! https://iceberg.apache.org/puffin-spec/
-	//! File layout:   Magic | Blob | Footer
+	//! File layout:   Magic | Blob_1 | ... | Blob_n | Footer
 	//! Footer layout: Magic | FooterPayload (JSON) | FooterPayloadSize (4 bytes, little-endian) |
 	//!                Flags (4 bytes) | Magic
 	constexpr data_t PUFFIN_MAGIC[4] = {0x50, 0x46, 0x41, 0x31}; //! "PFA1"
-	const idx_t blob_offset = sizeof(PUFFIN_MAGIC);
+	D_ASSERT(!blobs.empty());
 
 	//! Build the FooterPayload (FileMetadata). Per the spec, for `deletion-vector-v1` the blob's
 	//! `snapshot-id` and `sequence-number` must be -1, and it must carry the `referenced-data-file`
-	//! and `cardinality` properties. The blob is not compressed (no `compression-codec`).
+	//! and `cardinality` properties. The blobs are not compressed (no `compression-codec`).
 	JSONWriter writer;
 	auto root = writer.CreateObject();
 	writer.SetRoot(root);
-	auto blobs = writer.CreateArray();
-	root.Add("blobs", blobs);
-	auto blob_meta = writer.CreateObject();
-	blobs.Append(blob_meta);
-	blob_meta.AddString("type", "deletion-vector-v1");
-	blob_meta.Add("fields", writer.CreateArray());
-	blob_meta.Add("snapshot-id", writer.CreateSignedInteger(-1));
-	blob_meta.Add("sequence-number", writer.CreateSignedInteger(-1));
-	blob_meta.Add("offset", writer.CreateSignedInteger(static_cast<int64_t>(blob_offset)));
-	blob_meta.Add("length", writer.CreateSignedInteger(static_cast<int64_t>(blob.size())));
-	auto props = writer.CreateObject();
-	blob_meta.Add("properties", props);
-	props.AddString("referenced-data-file", referenced_data_file);
-	props.AddString("cardinality", std::to_string(cardinality));
+	auto blobs_meta = writer.CreateArray();
+	root.Add("blobs", blobs_meta);
+	idx_t blob_offset = sizeof(PUFFIN_MAGIC);
+	for (auto &blob : blobs) {
+		blob.offset = blob_offset;
+		blob_offset += blob.data.size();
+
+		auto blob_meta = writer.CreateObject();
+		blobs_meta.Append(blob_meta);
+		blob_meta.AddString("type", "deletion-vector-v1");
+		blob_meta.Add("fields", writer.CreateArray());
+		blob_meta.Add("snapshot-id", writer.CreateSignedInteger(-1));
+		blob_meta.Add("sequence-number", writer.CreateSignedInteger(-1));
+		blob_meta.Add("offset", writer.CreateSignedInteger(static_cast<int64_t>(blob.offset)));
+		blob_meta.Add("length", writer.CreateSignedInteger(static_cast<int64_t>(blob.data.size())));
+		auto props = writer.CreateObject();
+		blob_meta.Add("properties", props);
+		props.AddString("referenced-data-file", blob.referenced_data_file);
+		props.AddString("cardinality", std::to_string(blob.cardinality));
+	}
 	auto footer_payload = writer.ToString(JSONWriteFlags::ALLOW_INF_AND_NAN);
 
 	const idx_t footer_payload_size = footer_payload.size();
-	const idx_t total_size = blob_offset + blob.size() + sizeof(PUFFIN_MAGIC) + footer_payload_size +
+	const idx_t total_size = blob_offset + sizeof(PUFFIN_MAGIC) + footer_payload_size +
 	                         sizeof(int32_t) /* FooterPayloadSize */ + sizeof(uint32_t) /* Flags */ +
 	                         sizeof(PUFFIN_MAGIC);
 
@@ -305,9 +364,11 @@ vector<data_t> IcebergDeletionVectorData::ToPuffinFile(const vector<data_t> &blo
 	//! Magic
 	memcpy(ptr, PUFFIN_MAGIC, sizeof(PUFFIN_MAGIC));
 	ptr += sizeof(PUFFIN_MAGIC);
-	//! Blob (starts at blob_offset == 4)
-	memcpy(ptr, blob.data(), blob.size());
-	ptr += blob.size();
+	//! Blobs, back to back (the first starts at offset 4)
+	for (auto &blob : blobs) {
+		memcpy(ptr, blob.data.data(), blob.data.size());
+		ptr += blob.data.size();
+	}
 	//! Footer: leading Magic
 	memcpy(ptr, PUFFIN_MAGIC, sizeof(PUFFIN_MAGIC));
 	ptr += sizeof(PUFFIN_MAGIC);
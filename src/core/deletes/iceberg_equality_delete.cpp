@@ -0,0 +1,211 @@
+#include "core/deletes/iceberg_equality_delete.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+static void HashRows(DataChunk &chunk, idx_t offset, idx_t count, Vector &hashes) {
+	D_ASSERT(chunk.ColumnCount() > 0);
+	for (idx_t column_idx = 0; column_idx < chunk.ColumnCount(); column_idx++) {
+		Vector column(chunk.data[column_idx], offset, offset + count);
+		if (column_idx == 0) {
+			VectorOperations::Hash(column, hashes, count);
+		} else {
+			VectorOperations::CombineHash(hashes, column, count);
+		}
+	}
+}
+
+void IcebergEqualityDeleteFile::Finalize() {
+	auto row_count = equality_values.size();
+	first_row.clear();
+	first_row.reserve(row_count);
+	next_row.assign(row_count, DConstants::INVALID_INDEX);
+
+	Vector hashes(LogicalType::HASH);
+	for (idx_t offset = 0; offset < row_count; offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, row_count - offset);
+		HashRows(equality_values, offset, count, hashes);
+		hashes.Flatten(count);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto row_idx = offset + i;
+			auto entry = first_row.emplace(hash_data[i], row_idx);
+			if (!entry.second) {
+				next_row[row_idx] = entry.first->second;
+				entry.first->second = row_idx;
+			}
+		}
+	}
+	value_formats = equality_values.ToUnifiedFormat();
+}
+
+shared_ptr<const IcebergEqualityDeleteFile> IcebergEqualityDeleteFile::CastTo(ClientContext &context,
+                                                                              const vector<LogicalType> &types) const {
+	D_ASSERT(types.size() == equality_values.ColumnCount());
+	lock_guard<mutex> guard(cast_lock);
+	for (auto &cast : casts) {
+		if (cast->equality_values.GetTypes() == types) {
+			return cast;
+		}
+	}
+	auto result = make_shared_ptr<IcebergEqualityDeleteFile>(equality_ids, sequence_number);
+	auto row_count = equality_values.size();
+	auto &result_values = result->equality_values;
+	result_values.Initialize(context, types, row_count);
+	for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+		auto &source = const_cast<Vector &>(equality_values.data[column_idx]);
+		auto &target = result_values.data[column_idx];
+		if (source.GetType() == target.GetType()) {
+			VectorOperations::Copy(source, target, row_count, 0, 0);
+		} else {
+			VectorOperations::Cast(context, source, target, row_count);
+		}
+	}
+	result_values.SetCardinality(row_count);
+	result->Finalize();
+	casts.push_back(result);
+	return result;
+}
+
+template <class T>
+static void MatchColumnTyped(const UnifiedVectorFormat &key_format, const UnifiedVectorFormat &value_format,
+                             const idx_t *key_rows, const idx_t *delete_rows, idx_t count, bool *matches) {
+	auto key_data = UnifiedVectorFormat::GetData<T>(key_format);
+	auto value_data = UnifiedVectorFormat::GetData<T>(value_format);
+	for (idx_t i = 0; i < count; i++) {
+		if (!matches[i]) {
+			continue;
+		}
+		auto key_idx = key_format.sel->get_index(key_rows[i]);
+		auto value_idx = value_format.sel->get_index(delete_rows[i]);
+		matches[i] = NotDistinctFrom::Operation<T>(key_data[key_idx], value_data[value_idx],
+		                                           !key_format.validity.RowIsValid(key_idx),
+		                                           !value_format.validity.RowIsValid(value_idx));
+	}
+}
+
+void IcebergEqualityDeleteFile::MatchColumn(DataChunk &keys, const UnifiedVectorFormat &key_format, idx_t column_idx,
+                                            const idx_t *key_rows, const idx_t *delete_rows, idx_t count,
+                                            bool *matches) const {
+	auto &value_format = value_formats[column_idx];
+	switch (keys.data[column_idx].GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return MatchColumnTyped<bool>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::INT8:
+		return MatchColumnTyped<int8_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::INT16:
+		return MatchColumnTyped<int16_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::INT32:
+		return MatchColumnTyped<int32_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::INT64:
+		return MatchColumnTyped<int64_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::UINT8:
+		return MatchColumnTyped<uint8_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::UINT16:
+		return MatchColumnTyped<uint16_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::UINT32:
+		return MatchColumnTyped<uint32_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::UINT64:
+		return MatchColumnTyped<uint64_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::INT128:
+		return MatchColumnTyped<hugeint_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::UINT128:
+		return MatchColumnTyped<uhugeint_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::FLOAT:
+		return MatchColumnTyped<float>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::DOUBLE:
+		return MatchColumnTyped<double>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::INTERVAL:
+		return MatchColumnTyped<interval_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	case PhysicalType::VARCHAR:
+		return MatchColumnTyped<string_t>(key_format, value_format, key_rows, delete_rows, count, matches);
+	default:
+		//! Nested types are compared as values
+		for (idx_t i = 0; i < count; i++) {
+			if (!matches[i]) {
+				continue;
+			}
+			auto key = keys.GetValue(column_idx, key_rows[i]);
+			auto deleted = equality_values.GetValue(column_idx, delete_rows[i]);
+			matches[i] = Value::NotDistinctFrom(key, deleted);
+		}
+		return;
+	}
+}
+
+idx_t IcebergEqualityDeleteFile::Filter(DataChunk &keys, const SelectionVector &sel, idx_t count,
+                                        SelectionVector &result) const {
+	D_ASSERT(keys.ColumnCount() == equality_values.ColumnCount());
+	if (first_row.empty()) {
+		for (idx_t i = 0; i < count; i++) {
+			result.set_index(i, sel.get_index(i));
+		}
+		return count;
+	}
+
+	//! Hash every row once, only rows whose hash is present in the index have their values compared
+	Vector hashes(LogicalType::HASH);
+	HashRows(keys, 0, keys.size(), hashes);
+	UnifiedVectorFormat hash_format;
+	hashes.ToUnifiedFormat(keys.size(), hash_format);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hash_format);
+
+	//! The (key row, delete row) pairs left to compare, 'positions' holds the index into 'sel' of the key row.
+	//! Every round compares all pairs column by column, then advances the pairs that differ along their hash chain.
+	auto key_rows = make_unsafe_uniq_array<idx_t>(count);
+	auto delete_rows = make_unsafe_uniq_array<idx_t>(count);
+	auto positions = make_unsafe_uniq_array<idx_t>(count);
+	auto matches = make_unsafe_uniq_array<bool>(count);
+	auto is_deleted = make_unsafe_uniq_array<bool>(count);
+	idx_t pair_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		is_deleted[i] = false;
+		auto row_idx = sel.get_index(i);
+		auto entry = first_row.find(hash_data[hash_format.sel->get_index(row_idx)]);
+		if (entry != first_row.end()) {
+			key_rows[pair_count] = row_idx;
+			delete_rows[pair_count] = entry->second;
+			positions[pair_count] = i;
+			pair_count++;
+		}
+	}
+
+	auto key_formats = keys.ToUnifiedFormat();
+	while (pair_count > 0) {
+		for (idx_t i = 0; i < pair_count; i++) {
+			matches[i] = true;
+		}
+		for (idx_t column_idx = 0; column_idx < keys.ColumnCount(); column_idx++) {
+			MatchColumn(keys, key_formats[column_idx], column_idx, key_rows.get(), delete_rows.get(), pair_count,
+			            matches.get());
+		}
+		idx_t next_count = 0;
+		for (idx_t i = 0; i < pair_count; i++) {
+			if (matches[i]) {
+				is_deleted[positions[i]] = true;
+				continue;
+			}
+			auto next = next_row[delete_rows[i]];
+			if (next != DConstants::INVALID_INDEX) {
+				key_rows[next_count] = key_rows[i];
+				delete_rows[next_count] = next;
+				positions[next_count] = positions[i];
+				next_count++;
+			}
+		}
+		pair_count = next_count;
+	}
+
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (!is_deleted[i]) {
+			result.set_index(result_count++, sel.get_index(i));
+		}
+	}
+	return result_count;
+}
+
+} // namespace duckdb
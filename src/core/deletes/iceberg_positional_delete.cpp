@@ -2,12 +2,40 @@
 
 namespace duckdb {
 
+void IcebergPositionalDeleteData::AddRows(const int64_t *row_ids, idx_t count) {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	uint32_t low_bits[STANDARD_VECTOR_SIZE];
+	idx_t run_start = 0;
+	while (run_start < count) {
+		//! Positions are sorted within a delete file, so runs sharing the high bits are added at once
+		if (row_ids[run_start] < 0) {
+			throw InvalidInputException("Positional delete file contains a negative position (%d)", row_ids[run_start]);
+		}
+		auto high_bits = static_cast<int32_t>(row_ids[run_start] >> 32);
+		idx_t run_end = run_start;
+		for (; run_end < count && static_cast<int32_t>(row_ids[run_end] >> 32) == high_bits; run_end++) {
+			low_bits[run_end - run_start] = static_cast<uint32_t>(row_ids[run_end] & 0xFFFFFFFF);
+		}
+		bitmaps[high_bits].addMany(run_end - run_start, low_bits);
+		run_start = run_end;
+	}
+}
+
+void IcebergPositionalDeleteData::Merge(const IcebergPositionalDeleteData &other) {
+	for (auto &entry : other.entries) {
+		entries.push_back(entry);
+	}
+	for (auto &entry : other.bitmaps) {
+		bitmaps[entry.first] |= entry.second;
+	}
+}
+
 unique_ptr<DeleteFilter> IcebergPositionalDeleteData::ToFilter() const {
-	return make_uniq<IcebergPositionalDeleteFilter>(shared_from_this());
+	return make_uniq<IcebergDeletionVector>(shared_from_this(), bitmaps);
 }
 
-void IcebergPositionalDeleteData::ToSet(set<idx_t> &out) const {
-	out.insert(invalid_rows.begin(), invalid_rows.end());
+void IcebergPositionalDeleteData::AppendPositions(vector<idx_t> &out) const {
+	IcebergDeletionVectorData::AppendBitmapPositions(bitmaps, out);
 }
 
 } // namespace duckdb
@@ -18,13 +18,13 @@ bool IcebergPredicateStats::BoundsAreNull() const {
 	return lower_bound && upper_bound && lower_bound->IsNull() && upper_bound->IsNull();
 }
 
-static shared_ptr<BaseStatistics> BuildGeometryStats(const Value &lower_bound, const Value &upper_bound,
-                                                     const LogicalType &type) {
-	if (lower_bound.IsNull() || upper_bound.IsNull()) {
+static shared_ptr<BaseStatistics> BuildGeometryStats(const optional<string_t> &lower_bound,
+                                                     const optional<string_t> &upper_bound, const LogicalType &type) {
+	if (!lower_bound || !upper_bound) {
 		return nullptr;
 	}
-	auto lower_blob = lower_bound.GetValueUnsafe<string_t>();
-	auto upper_blob = upper_bound.GetValueUnsafe<string_t>();
+	auto &lower_blob = *lower_bound;
+	auto &upper_blob = *upper_bound;
 	const auto lower_coordinate_card = lower_blob.GetSize() / sizeof(double);
 	const auto upper_coordinate_card = upper_blob.GetSize() / sizeof(double);
 	if (lower_coordinate_card < 2 || upper_coordinate_card < 2) {
@@ -50,8 +50,22 @@ static shared_ptr<BaseStatistics> BuildGeometryStats(const Value &lower_bound, c
 	return stats;
 }
 
+static optional<string_t> BlobOrNull(const Value &bound) {
+	if (bound.IsNull()) {
+		return std::nullopt;
+	}
+	D_ASSERT(bound.type().id() == LogicalTypeId::BLOB);
+	return bound.GetValueUnsafe<string_t>();
+}
+
 IcebergPredicateStats IcebergPredicateStats::DeserializeBounds(const Value &lower_bound, const Value &upper_bound,
                                                                const string &name, const LogicalType &type) {
+	return DeserializeBounds(BlobOrNull(lower_bound), BlobOrNull(upper_bound), name, type);
+}
+
+IcebergPredicateStats IcebergPredicateStats::DeserializeBounds(const optional<string_t> &lower_bound,
+                                                               const optional<string_t> &upper_bound,
+                                                               const string &name, const LogicalType &type) {
 	IcebergPredicateStats result;
 	if (type.id() == LogicalTypeId::GEOMETRY) {
 		result.geometry_stats = BuildGeometryStats(lower_bound, upper_bound, type);
@@ -62,18 +76,16 @@ IcebergPredicateStats IcebergPredicateStats::DeserializeBounds(const Value &lowe
 		return result;
 	}
 
-	if (!lower_bound.IsNull()) {
-		D_ASSERT(lower_bound.type().id() == LogicalTypeId::BLOB);
-		auto deserialized = IcebergValue::DeserializeValue(lower_bound.GetValueUnsafe<string_t>(), type);
+	if (lower_bound) {
+		auto deserialized = IcebergValue::DeserializeValue(*lower_bound, type);
 		if (deserialized.HasError()) {
 			throw InvalidConfigurationException("Column %s lower bound deserialization failed: %s", name,
 			                                    deserialized.GetError());
 		}
 		result.SetLowerBound(deserialized.GetValue());
 	}
-	if (!upper_bound.IsNull()) {
-		D_ASSERT(upper_bound.type().id() == LogicalTypeId::BLOB);
-		auto deserialized = IcebergValue::DeserializeValue(upper_bound.GetValueUnsafe<string_t>(), type);
+	if (upper_bound) {
+		auto deserialized = IcebergValue::DeserializeValue(*upper_bound, type);
 		if (deserialized.HasError()) {
 			throw InvalidConfigurationException("Column %s upper bound deserialization failed: %s", name,
 			                                    deserialized.GetError());
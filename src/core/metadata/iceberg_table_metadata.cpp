@@ -554,6 +554,17 @@ bool IcebergTableMetadata::PropertiesAllowPositionalDeletes(IcebergSnapshotOpera
 	}
 }
 
+bool IcebergTableMetadata::PropertiesRequireCopyOnWrite(IcebergSnapshotOperationType operation_type) const {
+	switch (operation_type) {
+	case IcebergSnapshotOperationType::DELETE:
+		return GetTableProperty(WRITE_DELETE_MODE) == "copy-on-write";
+	case IcebergSnapshotOperationType::OVERWRITE:
+		return GetTableProperty(WRITE_UPDATE_MODE) == "copy-on-write";
+	default:
+		throw NotImplementedException("Operation type not supported");
+	}
+}
+
 JSONMutableValue IcebergTableMetadata::SchemasToJSON(JSONWriter &writer) const {
 	auto schemas_array = writer.CreateArray();
 	for (auto &it : schemas) {
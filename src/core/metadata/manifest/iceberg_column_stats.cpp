@@ -0,0 +1,213 @@
+#include "core/metadata/manifest/iceberg_column_stats.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+IcebergColumnStatsBatch::IcebergColumnStatsBatch() {
+}
+
+void IcebergColumnStatsBatch::Reserve(idx_t row_count) {
+	field_ids.reserve(row_count);
+	flags.reserve(row_count);
+	column_sizes.reserve(row_count);
+	value_counts.reserve(row_count);
+	null_value_counts.reserve(row_count);
+	nan_value_counts.reserve(row_count);
+	lower_bounds.reserve(row_count);
+	upper_bounds.reserve(row_count);
+}
+
+idx_t IcebergColumnStatsBatch::AppendRow(int32_t field_id) {
+	return InsertRow(Size(), field_id);
+}
+
+idx_t IcebergColumnStatsBatch::InsertRow(idx_t row_idx, int32_t field_id) {
+	D_ASSERT(row_idx <= Size());
+	field_ids.insert(field_ids.begin() + NumericCast<int64_t>(row_idx), field_id);
+	flags.insert(flags.begin() + NumericCast<int64_t>(row_idx), 0);
+	column_sizes.insert(column_sizes.begin() + NumericCast<int64_t>(row_idx), 0);
+	value_counts.insert(value_counts.begin() + NumericCast<int64_t>(row_idx), 0);
+	null_value_counts.insert(null_value_counts.begin() + NumericCast<int64_t>(row_idx), 0);
+	nan_value_counts.insert(nan_value_counts.begin() + NumericCast<int64_t>(row_idx), 0);
+	lower_bounds.insert(lower_bounds.begin() + NumericCast<int64_t>(row_idx), string_t());
+	upper_bounds.insert(upper_bounds.begin() + NumericCast<int64_t>(row_idx), string_t());
+	return row_idx;
+}
+
+void IcebergColumnStatsBatch::AppendRow(const IcebergColumnStatsBatch &source, idx_t row_idx) {
+	auto target_idx = AppendRow(source.field_ids[row_idx]);
+	flags[target_idx] = source.flags[row_idx];
+	column_sizes[target_idx] = source.column_sizes[row_idx];
+	value_counts[target_idx] = source.value_counts[row_idx];
+	null_value_counts[target_idx] = source.null_value_counts[row_idx];
+	nan_value_counts[target_idx] = source.nan_value_counts[row_idx];
+	if (source.HasStat(row_idx, IcebergColumnStatType::LOWER_BOUND)) {
+		lower_bounds[target_idx] = heap.AddBlob(source.lower_bounds[row_idx]);
+	}
+	if (source.HasStat(row_idx, IcebergColumnStatType::UPPER_BOUND)) {
+		upper_bounds[target_idx] = heap.AddBlob(source.upper_bounds[row_idx]);
+	}
+}
+
+vector<int64_t> &IcebergColumnStatsBatch::GetCounts(IcebergColumnStatType type) {
+	switch (type) {
+	case IcebergColumnStatType::COLUMN_SIZE:
+		return column_sizes;
+	case IcebergColumnStatType::VALUE_COUNT:
+		return value_counts;
+	case IcebergColumnStatType::NULL_VALUE_COUNT:
+		return null_value_counts;
+	case IcebergColumnStatType::NAN_VALUE_COUNT:
+		return nan_value_counts;
+	default:
+		throw InternalException("IcebergColumnStatType %d is not a count", static_cast<uint8_t>(type));
+	}
+}
+
+const vector<int64_t> &IcebergColumnStatsBatch::GetCounts(IcebergColumnStatType type) const {
+	return const_cast<IcebergColumnStatsBatch &>(*this).GetCounts(type);
+}
+
+int64_t IcebergColumnStatsBatch::GetCount(idx_t row_idx, IcebergColumnStatType type) const {
+	D_ASSERT(HasStat(row_idx, type));
+	return GetCounts(type)[row_idx];
+}
+
+const string_t &IcebergColumnStatsBatch::GetBound(idx_t row_idx, IcebergColumnStatType type) const {
+	D_ASSERT(HasStat(row_idx, type));
+	switch (type) {
+	case IcebergColumnStatType::LOWER_BOUND:
+		return lower_bounds[row_idx];
+	case IcebergColumnStatType::UPPER_BOUND:
+		return upper_bounds[row_idx];
+	default:
+		throw InternalException("IcebergColumnStatType %d is not a bound", static_cast<uint8_t>(type));
+	}
+}
+
+void IcebergColumnStatsBatch::SetCount(idx_t row_idx, IcebergColumnStatType type, int64_t value) {
+	GetCounts(type)[row_idx] = value;
+	flags[row_idx] |= StatFlag(type);
+}
+
+void IcebergColumnStatsBatch::SetBound(idx_t row_idx, IcebergColumnStatType type, const char *data, idx_t size) {
+	auto blob = heap.AddBlob(data, size);
+	switch (type) {
+	case IcebergColumnStatType::LOWER_BOUND:
+		lower_bounds[row_idx] = blob;
+		break;
+	case IcebergColumnStatType::UPPER_BOUND:
+		upper_bounds[row_idx] = blob;
+		break;
+	default:
+		throw InternalException("IcebergColumnStatType %d is not a bound", static_cast<uint8_t>(type));
+	}
+	flags[row_idx] |= StatFlag(type);
+}
+
+IcebergColumnStats::IcebergColumnStats() {
+}
+
+IcebergColumnStats::IcebergColumnStats(shared_ptr<IcebergColumnStatsBatch> batch_p, idx_t offset_p, idx_t count_p)
+    : batch(std::move(batch_p)), offset(offset_p), count(count_p) {
+	D_ASSERT(!count || (batch && offset + count <= batch->Size()));
+}
+
+bool IcebergColumnStats::HasAny(IcebergColumnStatType type) const {
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		if (RowHasStat(row_idx, type)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+idx_t IcebergColumnStats::CountFields(IcebergColumnStatType type) const {
+	idx_t result = 0;
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		result += RowHasStat(row_idx, type);
+	}
+	return result;
+}
+
+optional_idx IcebergColumnStats::FindRow(int32_t field_id) const {
+	if (!count) {
+		return optional_idx();
+	}
+	auto begin = batch->field_ids.begin() + NumericCast<int64_t>(offset);
+	auto end = begin + NumericCast<int64_t>(count);
+	auto it = std::lower_bound(begin, end, field_id);
+	if (it == end || *it != field_id) {
+		return optional_idx();
+	}
+	return NumericCast<idx_t>(it - batch->field_ids.begin());
+}
+
+optional<int64_t> IcebergColumnStats::GetCount(IcebergColumnStatType type, int32_t field_id) const {
+	auto row_idx = FindRow(field_id);
+	if (!row_idx.IsValid() || !batch->HasStat(row_idx.GetIndex(), type)) {
+		return std::nullopt;
+	}
+	return batch->GetCount(row_idx.GetIndex(), type);
+}
+
+optional<string_t> IcebergColumnStats::GetBound(IcebergColumnStatType type, int32_t field_id) const {
+	auto row_idx = FindRow(field_id);
+	if (!row_idx.IsValid() || !batch->HasStat(row_idx.GetIndex(), type)) {
+		return std::nullopt;
+	}
+	return batch->GetBound(row_idx.GetIndex(), type);
+}
+
+Value IcebergColumnStats::GetBoundValue(IcebergColumnStatType type, int32_t field_id) const {
+	auto bound = GetBound(type, field_id);
+	if (!bound) {
+		return Value(LogicalType::BLOB);
+	}
+	return Value::BLOB(const_data_ptr_cast(bound->GetData()), bound->GetSize());
+}
+
+idx_t IcebergColumnStats::GetOrCreateRow(int32_t field_id) {
+	bool owns_batch = batch && batch.use_count() == 1 && offset == 0 && count == batch->Size();
+	if (!owns_batch) {
+		auto new_batch = make_shared_ptr<IcebergColumnStatsBatch>();
+		new_batch->Reserve(count + 1);
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			new_batch->AppendRow(*batch, offset + row_idx);
+		}
+		batch = std::move(new_batch);
+		offset = 0;
+	}
+
+	auto &field_ids = batch->field_ids;
+	auto it = std::lower_bound(field_ids.begin(), field_ids.end(), field_id);
+	auto row_idx = NumericCast<idx_t>(it - field_ids.begin());
+	if (it != field_ids.end() && *it == field_id) {
+		return row_idx;
+	}
+	count++;
+	return batch->InsertRow(row_idx, field_id);
+}
+
+void IcebergColumnStats::SetCount(IcebergColumnStatType type, int32_t field_id, int64_t value) {
+	auto row_idx = GetOrCreateRow(field_id);
+	batch->SetCount(row_idx, type, value);
+}
+
+void IcebergColumnStats::SetBound(IcebergColumnStatType type, int32_t field_id, const string_t &blob) {
+	auto row_idx = GetOrCreateRow(field_id);
+	batch->SetBound(row_idx, type, blob.GetData(), blob.GetSize());
+}
+
+void IcebergColumnStats::SetBound(IcebergColumnStatType type, int32_t field_id, const Value &blob) {
+	if (blob.IsNull()) {
+		return;
+	}
+	SetBound(type, field_id, blob.GetValueUnsafe<string_t>());
+}
+
+} // namespace duckdb
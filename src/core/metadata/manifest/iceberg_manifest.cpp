@@ -25,9 +25,8 @@ using IntStringMapWriter = VectorWriter<VectorListType<VectorStructType<int32_t,
 using Int32ListWriter = VectorWriter<VectorListType<int32_t>>;
 using Int64ListWriter = VectorWriter<VectorListType<int64_t>>;
 
-template <class MAP>
-static void WriteIntIntMap(IntIntMapWriter &writer, const MAP &map);
-static void WriteBoundsMap(IntStringMapWriter &writer, const unordered_map<int32_t, Value> &bounds);
+static void WriteCountsMap(IntIntMapWriter &writer, const IcebergColumnStats &stats, IcebergColumnStatType type);
+static void WriteBoundsMap(IntStringMapWriter &writer, const IcebergColumnStats &stats, IcebergColumnStatType type);
 static void WriteInt32List(Int32ListWriter &writer, const vector<int32_t> &values);
 static void WriteInt64List(Int64ListWriter &writer, const vector<int64_t> &values);
 static void WritePartitionStructRow(Vector &partition_vector, idx_t row_idx, const IcebergDataFile &data_file,
@@ -84,13 +83,14 @@ struct DataFileVectorWriters {
 		record_count.WriteValue(data_file.record_count);
 		file_size_in_bytes.WriteValue(data_file.file_size_in_bytes);
 
-		WriteIntIntMap(column_sizes, data_file.column_sizes);
-		WriteIntIntMap(value_counts, data_file.value_counts);
-		WriteIntIntMap(null_value_counts, data_file.null_value_counts);
-		WriteIntIntMap(nan_value_counts, data_file.nan_value_counts);
+		auto &column_stats = data_file.column_stats;
+		WriteCountsMap(column_sizes, column_stats, IcebergColumnStatType::COLUMN_SIZE);
+		WriteCountsMap(value_counts, column_stats, IcebergColumnStatType::VALUE_COUNT);
+		WriteCountsMap(null_value_counts, column_stats, IcebergColumnStatType::NULL_VALUE_COUNT);
+		WriteCountsMap(nan_value_counts, column_stats, IcebergColumnStatType::NAN_VALUE_COUNT);
 
-		WriteBoundsMap(lower_bounds, data_file.lower_bounds);
-		WriteBoundsMap(upper_bounds, data_file.upper_bounds);
+		WriteBoundsMap(lower_bounds, column_stats, IcebergColumnStatType::LOWER_BOUND);
+		WriteBoundsMap(upper_bounds, column_stats, IcebergColumnStatType::UPPER_BOUND);
 
 		if (data_file.split_offsets.empty()) {
 			split_offsets.WriteNull();
@@ -475,32 +475,37 @@ static Value CreateFieldID(int32_t field_id, bool nullable) {
 
 namespace {
 
-template <class MAP>
-static void WriteIntIntMap(IntIntMapWriter &writer, const MAP &map) {
-	auto list = writer.WriteList(map.size());
-	auto it = map.begin();
+//! Returns the next row at or after 'row_idx' that has a statistic of 'type'
+static idx_t NextStatRow(const IcebergColumnStats &stats, IcebergColumnStatType type, idx_t row_idx) {
+	while (!stats.RowHasStat(row_idx, type)) {
+		row_idx++;
+	}
+	return row_idx;
+}
+
+static void WriteCountsMap(IntIntMapWriter &writer, const IcebergColumnStats &stats, IcebergColumnStatType type) {
+	auto list = writer.WriteList(stats.CountFields(type));
+	idx_t row_idx = 0;
 	for (auto &entry_writer : list) {
-		auto &entry = *it++;
+		row_idx = NextStatRow(stats, type, row_idx);
 		entry_writer.WriteValue([&](auto &key_writer, auto &value_writer) {
-			key_writer.WriteValue(entry.first);
-			value_writer.WriteValue(entry.second);
+			key_writer.WriteValue(stats.RowFieldId(row_idx));
+			value_writer.WriteValue(stats.RowStatCount(row_idx, type));
 		});
+		row_idx++;
 	}
 }
 
-static void WriteBoundsMap(IntStringMapWriter &writer, const unordered_map<int32_t, Value> &bounds) {
-	auto list = writer.WriteList(bounds.size());
-	auto it = bounds.begin();
+static void WriteBoundsMap(IntStringMapWriter &writer, const IcebergColumnStats &stats, IcebergColumnStatType type) {
+	auto list = writer.WriteList(stats.CountFields(type));
+	idx_t row_idx = 0;
 	for (auto &entry_writer : list) {
-		auto &entry = *it++;
+		row_idx = NextStatRow(stats, type, row_idx);
 		entry_writer.WriteValue([&](auto &key_writer, auto &value_writer) {
-			key_writer.WriteValue(entry.first);
-			if (entry.second.IsNull()) {
-				value_writer.WriteNull();
-			} else {
-				value_writer.WriteValue(entry.second.GetValueUnsafe<string_t>());
-			}
+			key_writer.WriteValue(stats.RowFieldId(row_idx));
+			value_writer.WriteValue(stats.RowBound(row_idx, type));
 		});
+		row_idx++;
 	}
 }
 
@@ -619,20 +624,26 @@ static Value FieldIdsForList(int32_t list_field_id, int32_t element_field_id) {
 	return Value::STRUCT(members);
 }
 
-idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManifestListEntry &manifest_entry,
-                  CopyFunction &copy, DatabaseInstance &db, ClientContext &context) {
-	auto &manifest_file = manifest_entry.file;
-	if (!manifest_entry.manifest_metadata) {
+ManifestFileWriter::ManifestFileWriter(const IcebergTableMetadata &table_metadata,
+                                       const IcebergManifestListEntry &list_entry, CopyFunction &copy,
+                                       DatabaseInstance &db, ClientContext &context)
+    : table_metadata(table_metadata), list_entry(list_entry), copy(copy), db(db), context(context),
+      thread_context(context), execution_context(context, thread_context, nullptr) {
+	if (!list_entry.manifest_metadata) {
 		throw InternalException("Manifest entry for '%s' is missing typed manifest metadata",
-		                        manifest_file.manifest_path);
+		                        list_entry.file.manifest_path);
 	}
-	auto &manifest_entries = manifest_entry.GetManifestEntries();
-	auto &entry_metadata = *manifest_entry.manifest_metadata;
+	manifest_format_version = list_entry.manifest_metadata->format_version;
+}
+
+ManifestFileWriter::~ManifestFileWriter() {
+}
+
+void ManifestFileWriter::Initialize(const IcebergManifestEntry &first_entry) {
+	auto &entry_metadata = *list_entry.manifest_metadata;
 	auto manifest_metadata = GetManifestMetadataMap(table_metadata, entry_metadata);
-	auto manifest_format_version = entry_metadata.format_version;
-	D_ASSERT(!manifest_entries.empty());
 	auto &allocator = db.GetBufferManager().GetBufferAllocator();
-	auto &path = manifest_file.manifest_path;
+	auto &path = list_entry.file.manifest_path;
 
 	//! Create the types for the DataChunk
 
@@ -673,10 +684,7 @@ idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManif
 	children.emplace_back("file_format", LogicalType::VARCHAR);
 	data_file_field_ids.emplace_back("file_format", CreateFieldID(FILE_FORMAT, false));
 
-	auto &first_entry = manifest_entries.front();
-	auto &data_file = first_entry.data_file;
-
-	auto extended_partition_info = data_file.GetExtendedPartitionInfo(table_metadata);
+	extended_partition_info = first_entry.data_file.GetExtendedPartitionInfo(table_metadata);
 	child_list_t<Value> partition;
 	// partition: struct(...)
 	children.emplace_back("partition", PartitionStructType(extended_partition_info));
@@ -778,11 +786,6 @@ idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManif
 	data_file_field_ids.emplace_back("__duckdb_nullable", Value::BOOLEAN(false));
 	field_ids.emplace_back("data_file", Value::STRUCT(data_file_field_ids));
 
-	//! Populate the DataChunk with the data files
-
-	DataChunk chunk;
-	chunk.Initialize(allocator, types, STANDARD_VECTOR_SIZE);
-
 	child_list_t<Value> metadata_values;
 	constexpr const char *required_keys[] = {"schema",         "schema-id", "partition-spec", "partition-spec-id",
 	                                         "format-version", "content"};
@@ -812,20 +815,25 @@ idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManif
 	CopyFunctionBindInput input(copy_info);
 	input.file_extension = "avro";
 
-	ThreadContext thread_context(context);
-	ExecutionContext execution_context(context, thread_context, nullptr);
-	auto bind_data = copy.copy_to_bind(context, input, names, types);
+	bind_data = copy.copy_to_bind(context, input, names, types);
 
-	auto global_state = copy.copy_to_initialize_global(context, *bind_data, path);
-	auto local_state = copy.copy_to_initialize_local(execution_context, *bind_data);
-	CopyFunctionFileStatistics stats;
+	global_state = copy.copy_to_initialize_global(context, *bind_data, path);
+	local_state = copy.copy_to_initialize_local(execution_context, *bind_data);
 	copy.copy_to_get_written_statistics(context, *bind_data, *global_state, stats);
+	chunk.Initialize(allocator, types, STANDARD_VECTOR_SIZE);
+}
 
-	for (idx_t offset = 0; offset < manifest_entries.size(); offset += STANDARD_VECTOR_SIZE) {
-		const auto chunk_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, manifest_entries.size() - offset);
-		if (offset > 0) {
-			chunk.Reset();
-		}
+void ManifestFileWriter::Append(const vector<IcebergManifestEntry> &entries) {
+	if (entries.empty()) {
+		return;
+	}
+	if (!bind_data) {
+		Initialize(entries.front());
+	}
+	auto &manifest_file = list_entry.file;
+	for (idx_t offset = 0; offset < entries.size(); offset += STANDARD_VECTOR_SIZE) {
+		const auto chunk_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, entries.size() - offset);
+		chunk.Reset();
 
 		auto status_writer = FlatVector::Writer<int32_t>(chunk.data[0], chunk_count);
 		auto snapshot_id_writer = FlatVector::Writer<int64_t>(chunk.data[1], chunk_count);
@@ -834,51 +842,67 @@ idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManif
 		DataFileVectorWriters data_file_writers(chunk.data[4], chunk_count, table_metadata, manifest_format_version);
 
 		for (idx_t i = 0; i < chunk_count; i++) {
-			auto &manifest_entry = manifest_entries[offset + i];
-			status_writer.WriteValue(static_cast<int32_t>(manifest_entry.status));
+			auto &entry = entries[offset + i];
+			status_writer.WriteValue(static_cast<int32_t>(entry.status));
 			//! FIXME: this is missing logic, needs to be looked into
 			//! SPEC: Snapshot id where the file was added, or deleted if status is 2. Inherited when null.
 			// snapshot_id: long
-			if (manifest_entry.HasSnapshotId()) {
-				snapshot_id_writer.WriteValue(manifest_entry.GetSnapshotId());
+			if (entry.HasSnapshotId()) {
+				snapshot_id_writer.WriteValue(entry.GetSnapshotId());
 			} else {
 				snapshot_id_writer.WriteNull();
 			}
 			// sequence_number: long
 			// file_sequence_number: long
-			if (manifest_entry.status == IcebergManifestEntryStatusType::ADDED) {
-				auto sequence_number = manifest_entry.ExplicitSequenceNumber();
+			if (entry.status == IcebergManifestEntryStatusType::ADDED) {
+				auto sequence_number = entry.ExplicitSequenceNumber();
 				if (sequence_number) {
 					sequence_number_writer.WriteValue(*sequence_number);
 				} else {
 					sequence_number_writer.WriteNull();
 				}
-				auto file_sequence_number = manifest_entry.ExplicitFileSequenceNumber();
+				auto file_sequence_number = entry.ExplicitFileSequenceNumber();
 				if (file_sequence_number) {
 					file_sequence_number_writer.WriteValue(*file_sequence_number);
 				} else {
 					file_sequence_number_writer.WriteNull();
 				}
 			} else {
-				sequence_number_writer.WriteValue(manifest_entry.GetSequenceNumber(manifest_file));
-				file_sequence_number_writer.WriteValue(manifest_entry.GetFileSequenceNumber(manifest_file));
+				sequence_number_writer.WriteValue(entry.GetSequenceNumber(manifest_file));
+				file_sequence_number_writer.WriteValue(entry.GetFileSequenceNumber(manifest_file));
 			}
 
-			data_file_writers.WriteRow(i, manifest_entry.data_file, extended_partition_info);
+			data_file_writers.WriteRow(i, entry.data_file, extended_partition_info);
 		}
 
 		chunk.SetChildCardinality(chunk_count);
 		copy.copy_to_sink(execution_context, *bind_data, *global_state, *local_state, chunk);
+		row_count += chunk_count;
+	}
+}
+
+idx_t ManifestFileWriter::Finalize() {
+	if (!bind_data) {
+		throw InternalException("Cannot write manifest '%s' without entries", list_entry.file.manifest_path);
 	}
 	copy.copy_to_combine(execution_context, *bind_data, *global_state, *local_state);
 	copy.copy_to_finalize(context, *bind_data, *global_state);
-	if (stats.row_count != manifest_entries.size()) {
-		throw InternalException("Avro copy for manifest failed, expected %d written, found only %d",
-		                        manifest_entries.size(), stats.row_count);
+	if (stats.row_count != row_count) {
+		throw InternalException("Avro copy for manifest failed, expected %d written, found only %d", row_count,
+		                        stats.row_count);
 	}
 	return stats.file_size_bytes;
 }
 
+idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManifestListEntry &manifest_entry,
+                  CopyFunction &copy, DatabaseInstance &db, ClientContext &context) {
+	auto &manifest_entries = manifest_entry.GetManifestEntries();
+	D_ASSERT(!manifest_entries.empty());
+	ManifestFileWriter writer(table_metadata, manifest_entry, copy, db, context);
+	writer.Append(manifest_entries);
+	return writer.Finalize();
+}
+
 } // namespace manifest_file
 
 } // namespace duckdb
@@ -198,11 +198,10 @@ static void CollectDataManifestMetrics(const IcebergManifestEntry &manifest_entr
 	metrics.records += data_file.record_count;
 }
 
-IcebergManifestListEntry IcebergManifestListEntry::CreateFromEntries(FileSystem &fs, sequence_number_t sequence_number,
-                                                                     const IcebergTableMetadata &table_metadata,
-                                                                     const IcebergManifestMetadata &manifest_metadata,
-                                                                     vector<IcebergManifestEntry> &&manifest_entries,
-                                                                     int64_t &next_row_id) {
+IcebergManifestListEntry IcebergManifestListEntry::CreateEmpty(FileSystem &fs, sequence_number_t sequence_number,
+                                                               const IcebergTableMetadata &table_metadata,
+                                                               const IcebergManifestMetadata &manifest_metadata,
+                                                               int64_t next_row_id) {
 	//! create manifest file path
 	auto manifest_file_uuid = UUID::ToString(UUID::GenerateRandomUUID());
 	auto manifest_file_path = fs.JoinPath(table_metadata.GetMetadataPath(fs), manifest_file_uuid + "-m0.avro");
@@ -224,11 +223,50 @@ IcebergManifestListEntry IcebergManifestListEntry::CreateFromEntries(FileSystem
 	manifest_file.sequence_number = sequence_number;
 	manifest_file.counts = IcebergManifestCounts::Zero();
 	manifest_file.partition_spec_id = manifest_partition_spec_id;
+	//! NOTE: this gets assigned when the manifest is added to a manifest list
+	manifest_file.added_snapshot_id = nullopt;
 
 	manifest_list_entry.metrics.emplace();
-	auto &metrics = *manifest_list_entry.metrics;
+	return manifest_list_entry;
+}
+
+IcebergManifestListEntry IcebergManifestListEntry::CreateFromEntries(FileSystem &fs, sequence_number_t sequence_number,
+                                                                     const IcebergTableMetadata &table_metadata,
+                                                                     const IcebergManifestMetadata &manifest_metadata,
+                                                                     vector<IcebergManifestEntry> &&manifest_entries,
+                                                                     int64_t &next_row_id) {
+	auto manifest_list_entry = CreateEmpty(fs, sequence_number, table_metadata, manifest_metadata, next_row_id);
+
+	ManifestSummaryBuilder summary(table_metadata, manifest_list_entry);
+	summary.Update(manifest_entries, next_row_id);
+	summary.Finalize();
+
+	auto &stored_entries = manifest_list_entry.GetOrCreateManifestEntries();
+	stored_entries.insert(stored_entries.end(), std::make_move_iterator(manifest_entries.begin()),
+	                      std::make_move_iterator(manifest_entries.end()));
+	return manifest_list_entry;
+}
+
+ManifestSummaryBuilder::ManifestSummaryBuilder(const IcebergTableMetadata &table_metadata,
+                                               IcebergManifestListEntry &list_entry)
+    : list_entry(list_entry) {
+	D_ASSERT(list_entry.manifest_metadata && list_entry.metrics);
+	// Compute partition field summaries (upper/lower bounds) for the manifest list entry
+	if (table_metadata.HasPartitionSpec() && table_metadata.GetLatestPartitionSpec().IsPartitioned()) {
+		auto manifest_partition_spec_id = list_entry.file.partition_spec_id;
+		auto partition_spec_it = table_metadata.partition_specs.find(manifest_partition_spec_id);
+		if (partition_spec_it == table_metadata.partition_specs.end()) {
+			throw InternalException("Cannot find partition spec with id " + std::to_string(manifest_partition_spec_id));
+		}
+		partitions = make_uniq<ManifestPartitionsBuilder>(table_metadata, partition_spec_it->second);
+	}
+}
+
+void ManifestSummaryBuilder::Update(const vector<IcebergManifestEntry> &manifest_entries, int64_t &next_row_id) {
+	auto &manifest_file = list_entry.file;
+	auto &metrics = *list_entry.metrics;
+	auto manifest_content = list_entry.manifest_metadata->content;
 
-	//! Add the files to the manifest
 	for (auto &manifest_entry : manifest_entries) {
 		auto &data_file = manifest_entry.data_file;
 
@@ -250,7 +288,7 @@ IcebergManifestListEntry IcebergManifestListEntry::CreateFromEntries(FileSystem
 			    IcebergUtils::AddFileSizeChecked(entry_metrics.files_size, data_file.GetContentSizeInBytes());
 			entry_metrics.files_size = new_files_size;
 
-			if (manifest_metadata.content == IcebergManifestContentType::DATA) {
+			if (manifest_content == IcebergManifestContentType::DATA) {
 				CollectDataManifestMetrics(manifest_entry, entry_metrics);
 			} else {
 				CollectDeleteManifestMetrics(manifest_entry, entry_metrics);
@@ -263,27 +301,32 @@ IcebergManifestListEntry IcebergManifestListEntry::CreateFromEntries(FileSystem
 			manifest_file.min_sequence_number = entry_data_seq;
 		}
 	}
-	//! NOTE: this gets assigned when the manifest is added to a manifest list
-	manifest_file.added_snapshot_id = nullopt;
-
-	// Compute partition field summaries (upper/lower bounds) for the manifest list entry
-	if (table_metadata.HasPartitionSpec() && table_metadata.GetLatestPartitionSpec().IsPartitioned()) {
-		auto partition_spec_it = table_metadata.partition_specs.find(manifest_partition_spec_id);
-		if (partition_spec_it == table_metadata.partition_specs.end()) {
-			throw InternalException("Cannot find partition spec with id " + std::to_string(manifest_partition_spec_id));
-		}
-		auto &partition_spec = partition_spec_it->second;
-		manifest_file.partitions.Create(table_metadata, partition_spec, manifest_entries);
+	if (partitions) {
+		partitions->Update(manifest_entries);
 	}
+}
 
-	auto &stored_entries = manifest_list_entry.GetOrCreateManifestEntries();
-	stored_entries.insert(stored_entries.end(), std::make_move_iterator(manifest_entries.begin()),
-	                      std::make_move_iterator(manifest_entries.end()));
-	return manifest_list_entry;
+void ManifestSummaryBuilder::Finalize() {
+	if (partitions) {
+		partitions->Finalize(list_entry.file.partitions);
+	}
 }
 
 void ManifestPartitions::Create(const IcebergTableMetadata &metadata, const IcebergPartitionSpec &partition_spec,
                                 const vector<IcebergManifestEntry> &manifest_entries) {
+	ManifestPartitionsBuilder builder(metadata, partition_spec);
+	builder.Update(manifest_entries);
+	builder.Finalize(*this);
+}
+
+ManifestPartitionsBuilder::ManifestPartitionsBuilder(const IcebergTableMetadata &metadata,
+                                                     const IcebergPartitionSpec &partition_spec)
+    : metadata(metadata), partition_spec(partition_spec), contains_null(partition_spec.fields.size(), false),
+      min_values(partition_spec.fields.size()), max_values(partition_spec.fields.size()),
+      initialized(partition_spec.fields.size(), false) {
+}
+
+void ManifestPartitionsBuilder::Update(const vector<IcebergManifestEntry> &manifest_entries) {
 	if (manifest_entries.empty() || partition_spec.fields.empty()) {
 		return;
 	}
@@ -296,14 +339,9 @@ void ManifestPartitions::Create(const IcebergTableMetadata &metadata, const Iceb
 		}
 	}
 
-	has_partitions = true;
+	has_entries = true;
 
 	auto num_fields = partition_spec.fields.size();
-	field_summary.resize(num_fields);
-	vector<Value> min_values(num_fields);
-	vector<Value> max_values(num_fields);
-	vector<bool> initialized(num_fields, false);
-
 	for (auto &entry : manifest_entries) {
 		auto &data_file = entry.data_file;
 		auto data_extended_partition_info = data_file.GetExtendedPartitionInfo(metadata);
@@ -322,7 +360,7 @@ void ManifestPartitions::Create(const IcebergTableMetadata &metadata, const Iceb
 			}
 
 			if (!partition_info_exists || extended_partition_info.value.IsNull()) {
-				field_summary[i].contains_null = true;
+				contains_null[i] = true;
 				continue;
 			}
 
@@ -348,35 +386,27 @@ void ManifestPartitions::Create(const IcebergTableMetadata &metadata, const Iceb
 			}
 		}
 	}
+}
+
+void ManifestPartitionsBuilder::Finalize(ManifestPartitions &result) {
+	if (!has_entries) {
+		return;
+	}
+	result.has_partitions = true;
+
+	auto num_fields = partition_spec.fields.size();
+	auto &field_summary = result.field_summary;
+	field_summary.resize(num_fields);
 
 	// Serialize the min/max values as bounds
 	for (idx_t i = 0; i < num_fields; i++) {
+		field_summary[i].contains_null = contains_null[i];
 		if (!initialized[i]) {
 			// All values for this field are null - set bounds to null BLOBs
 			field_summary[i].lower_bound = Value(LogicalType::BLOB);
 			field_summary[i].upper_bound = Value(LogicalType::BLOB);
 			continue;
 		}
-		auto &spec_field = partition_spec.fields[i];
-		// Find one IcebergPartitionInfo entry to get the type info
-		IcebergExtendedPartitionInfo extended_partition_info;
-		bool have_extended_partition_info = false;
-		for (auto &entry : manifest_entries) {
-			auto &data_file = entry.data_file;
-			auto data_extended_partition_info = data_file.GetExtendedPartitionInfo(metadata);
-			for (auto &pi : data_extended_partition_info) {
-				if (pi.field_id == spec_field.partition_field_id && !pi.value.IsNull()) {
-					extended_partition_info = pi;
-					have_extended_partition_info = true;
-					break;
-				}
-			}
-			if (have_extended_partition_info) {
-				break;
-			}
-		}
-		D_ASSERT(have_extended_partition_info);
-		auto serialized_type = extended_partition_info.transform.GetSerializedType(extended_partition_info.source_type);
 		// min/max_values already in their partition result value types. We cast those to varchar to serialize them
 		// again unless they are blob, in which case we do not cast and serialize
 		SerializeResult lower_result = SerializeResult(min_values[i].type(), min_values[i]);
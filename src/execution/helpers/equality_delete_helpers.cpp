@@ -508,11 +508,11 @@ void IcebergDelete::WriteEqualityDeleteFile(ClientContext &context, IcebergDelet
 			}
 		}
 		if (!has_null) {
-			delete_file.null_value_counts[predicate.field_id] = 0;
+			delete_file.column_stats.SetCount(IcebergColumnStatType::NULL_VALUE_COUNT, predicate.field_id, 0);
 		}
 		if (predicate.type.id() == LogicalTypeId::FLOAT || predicate.type.id() == LogicalTypeId::DOUBLE) {
 			if (!has_nan) {
-				delete_file.nan_value_counts[predicate.field_id] = 0;
+				delete_file.column_stats.SetCount(IcebergColumnStatType::NAN_VALUE_COUNT, predicate.field_id, 0);
 			}
 		}
 		if (!min_value || !max_value) {
@@ -522,13 +522,13 @@ void IcebergDelete::WriteEqualityDeleteFile(ClientContext &context, IcebergDelet
 		if (lower.HasError()) {
 			throw InvalidConfigurationException(lower.GetError());
 		} else if (lower.HasValue()) {
-			delete_file.lower_bounds[predicate.field_id] = lower.GetValue();
+			delete_file.column_stats.SetBound(IcebergColumnStatType::LOWER_BOUND, predicate.field_id, lower.GetValue());
 		}
 		auto upper = IcebergValue::SerializeValue(*max_value, predicate.type, SerializeBound::UPPER_BOUND);
 		if (upper.HasError()) {
 			throw InvalidConfigurationException(upper.GetError());
 		} else if (upper.HasValue()) {
-			delete_file.upper_bounds[predicate.field_id] = upper.GetValue();
+			delete_file.column_stats.SetBound(IcebergColumnStatType::UPPER_BOUND, predicate.field_id, upper.GetValue());
 		}
 	}
 
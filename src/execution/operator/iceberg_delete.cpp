@@ -12,6 +12,9 @@
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
 
 #include "catalog/rest/iceberg_catalog.hpp"
 #include "catalog/rest/transaction/iceberg_transaction.hpp"
@@ -19,10 +22,15 @@
 #include "catalog/rest/catalog_entry/table/iceberg_table.hpp"
 #include "planning/iceberg_multi_file_reader.hpp"
 #include "planning/iceberg_multi_file_list.hpp"
+#include "planning/metadata_io/deletes/iceberg_deletes_file_reader.hpp"
+#include "execution/operator/iceberg_insert.hpp"
+#include "function/iceberg_functions.hpp"
+#include "storage/statistics/iceberg_data_file_stats.hpp"
 #include "core/metadata/snapshot/iceberg_snapshot.hpp"
 #include "core/metadata/manifest/iceberg_manifest.hpp"
 
 #include "core/deletes/iceberg_deletion_vector.hpp"
+#include "common/iceberg_utils.hpp"
 #include "catalog/rest/transaction/iceberg_transaction_update.hpp"
 #include "iceberg_logging.hpp"
 
@@ -162,54 +170,9 @@ SinkCombineResultType IcebergDelete::Combine(ExecutionContext &context, Operator
 // Finalize
 //===--------------------------------------------------------------------===//
 
-void IcebergDelete::WriteDeletionVectorFile(ClientContext &context, IcebergDeleteGlobalState &global_state,
-                                            const string &filename, IcebergDeleteFileInfo delete_file,
-                                            const set<idx_t> &sorted_deletes) const {
-	auto delete_file_path = delete_file.file_name;
-
-	// Build deletion vector data
-	unordered_map<int32_t, roaring::Roaring> bitmaps;
-
-	// Group row indices by high 32 bits
-	for (auto row_idx : sorted_deletes) {
-		int64_t row_id = static_cast<int64_t>(row_idx);
-		int32_t high_bits = static_cast<int32_t>(row_id >> 32);
-		uint32_t low_bits = static_cast<uint32_t>(row_id & 0xFFFFFFFF);
-
-		auto &bitmap = bitmaps[high_bits];
-		bitmap.add(low_bits);
-	}
-
-	// Serialize the deletion vector to a blob, then wrap it in a valid Puffin file
-	// container (Magic + Blob + Footer) so the output is a spec-compliant Puffin file
-	// rather than a bare blob. The blob is placed at offset 4, after the leading magic.
-	auto blob_data = IcebergDeletionVectorData::ToBlob(bitmaps);
-	auto puffin_file = IcebergDeletionVectorData::ToPuffinFile(blob_data, filename, sorted_deletes.size());
-
-	// Write the Puffin file
-	auto &fs = FileSystem::GetFileSystem(context);
-	auto file_handle =
-	    fs.OpenFile(delete_file_path, FileOpenFlags::FILE_FLAGS_WRITE | FileOpenFlags::FILE_FLAGS_FILE_CREATE);
-	file_handle->Write(puffin_file.data(), puffin_file.size());
-	file_handle->Close();
-
-	delete_file.file_name = delete_file_path;
-	delete_file.file_format = "puffin";
-	delete_file.delete_count = sorted_deletes.size();
-	// The deletion-vector blob is written immediately after the 4-byte leading Puffin magic.
-	delete_file.content_offset = 4;
-	delete_file.content_size_in_bytes = blob_data.size();
-	delete_file.file_size_bytes = puffin_file.size();
-	DUCKDB_LOG(context, IcebergLogType,
-	           "Iceberg DELETE, wrote deletion_vector_file '%s' for data_file '%s', delete_count=%llu, "
-	           "file_size=%llu bytes",
-	           delete_file_path, filename, sorted_deletes.size(), puffin_file.size());
-	global_state.written_files.emplace(filename, std::move(delete_file));
-}
-
-void IcebergDelete::WritePositionalDeleteFile(ClientContext &context, IcebergDeleteGlobalState &global_state,
-                                              const string &filename, IcebergDeleteFileInfo delete_file,
-                                              set<idx_t> sorted_deletes) const {
+IcebergDeleteFileInfo IcebergDelete::WritePositionalDeleteFile(ClientContext &context, const string &filename,
+                                                               IcebergDeleteFileInfo delete_file,
+                                                               const vector<idx_t> &sorted_deletes) const {
 	auto delete_file_path = delete_file.file_name;
 	auto info = make_uniq<CopyInfo>();
 	info->file_path = delete_file_path;
@@ -294,7 +257,7 @@ void IcebergDelete::WritePositionalDeleteFile(ClientContext &context, IcebergDel
 	           "Iceberg DELETE, wrote positional_delete_file '%s' for data_file '%s', delete_count=%llu, "
 	           "file_size=%llu bytes",
 	           delete_file_path, filename, stats.row_count, stats.file_size_bytes);
-	global_state.written_files.emplace(filename, std::move(delete_file));
+	return delete_file;
 }
 
 static void PopulateAlteredManifests(const IcebergMultiFileList &multi_file_list, IcebergManifestDeletes &out,
@@ -303,8 +266,142 @@ static void PopulateAlteredManifests(const IcebergMultiFileList &multi_file_list
 		return;
 	}
 	for (auto &bound_entry : delete_data.entries) {
-		auto &entry = bound_entry.entry;
-		out.InvalidateFile(entry.data_file.file_path);
+		auto &manifest = multi_file_list.GetSourceManifest(bound_entry, IcebergManifestContentType::DELETE);
+		out.InvalidateEntry(bound_entry.entry.data_file, manifest);
+	}
+}
+
+//! Iceberg's default for 'write.delete.target-file-size-bytes'
+static constexpr idx_t DEFAULT_DELETE_TARGET_FILE_SIZE = 64ULL * 1024ULL * 1024ULL;
+
+namespace {
+
+//! The deletes of one data file, written to a delete file of its own (or packed with others into a Puffin file)
+struct PendingDeleteFile {
+	string data_file_path;
+	//! The directory of the data file, the delete file is written next to it
+	string data_file_dir;
+	IcebergDeleteFileInfo delete_file;
+	//! Sorted and free of duplicates
+	vector<idx_t> sorted_deletes;
+	IcebergDeletionVectorBlob deletion_vector;
+};
+
+//! Deletion vectors of data files in the same directory, written into one Puffin file
+struct DeletionVectorPack {
+	string file_path;
+	vector<idx_t> files;
+	idx_t size = 0;
+};
+
+} // namespace
+
+static IcebergDeletionVectorBlob CreateDeletionVectorBlob(const string &filename, const vector<idx_t> &sorted_deletes) {
+	// Build deletion vector data
+	deletion_bitmap_map_t bitmaps;
+
+	// Group row indices by high 32 bits
+	for (auto row_idx : sorted_deletes) {
+		int64_t row_id = static_cast<int64_t>(row_idx);
+		int32_t high_bits = static_cast<int32_t>(row_id >> 32);
+		uint32_t low_bits = static_cast<uint32_t>(row_id & 0xFFFFFFFF);
+
+		auto &bitmap = bitmaps[high_bits];
+		bitmap.add(low_bits);
+	}
+
+	IcebergDeletionVectorBlob result;
+	result.data = IcebergDeletionVectorData::ToBlob(bitmaps);
+	result.referenced_data_file = filename;
+	result.cardinality = sorted_deletes.size();
+	return result;
+}
+
+static void WriteDeletionVectorFile(ClientContext &context, const DeletionVectorPack &pack,
+                                    vector<PendingDeleteFile> &pending_files) {
+	// Wrap the blobs in a valid Puffin file container (Magic + Blobs + Footer), so the output is a spec-compliant
+	// Puffin file rather than bare blobs
+	vector<IcebergDeletionVectorBlob> blobs;
+	blobs.reserve(pack.files.size());
+	for (auto file_idx : pack.files) {
+		blobs.push_back(std::move(pending_files[file_idx].deletion_vector));
+	}
+	auto puffin_file = IcebergDeletionVectorData::ToPuffinFile(blobs);
+
+	// Write the Puffin file
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto file_handle =
+	    fs.OpenFile(pack.file_path, FileOpenFlags::FILE_FLAGS_WRITE | FileOpenFlags::FILE_FLAGS_FILE_CREATE);
+	file_handle->Write(puffin_file.data(), puffin_file.size());
+	file_handle->Close();
+
+	for (idx_t blob_idx = 0; blob_idx < blobs.size(); blob_idx++) {
+		auto &blob = blobs[blob_idx];
+		auto &delete_file = pending_files[pack.files[blob_idx]].delete_file;
+		delete_file.file_name = pack.file_path;
+		delete_file.file_format = "puffin";
+		delete_file.delete_count = blob.cardinality;
+		delete_file.content_offset = blob.offset;
+		delete_file.content_size_in_bytes = blob.data.size();
+		delete_file.file_size_bytes = puffin_file.size();
+	}
+	DUCKDB_LOG(context, IcebergLogType,
+	           "Iceberg DELETE, wrote deletion_vector_file '%s' for %llu data_files, file_size=%llu bytes",
+	           pack.file_path, blobs.size(), puffin_file.size());
+}
+
+//! Group the deletion vectors by the directory of their data file, and pack them into Puffin files of up to
+//! 'target_size' bytes
+static vector<DeletionVectorPack> PackDeletionVectors(FileSystem &fs, const vector<PendingDeleteFile> &pending_files,
+                                                      idx_t target_size) {
+	vector<DeletionVectorPack> packs;
+	unordered_map<string, idx_t> open_packs;
+	for (idx_t file_idx = 0; file_idx < pending_files.size(); file_idx++) {
+		auto &pending = pending_files[file_idx];
+		auto blob_size = pending.deletion_vector.data.size();
+		auto entry = open_packs.find(pending.data_file_dir);
+		if (entry == open_packs.end() || packs[entry->second].size + blob_size > target_size) {
+			DeletionVectorPack pack;
+			string delete_filename = UUID::ToString(UUID::GenerateRandomUUID()) + "-deletes.puffin";
+			pack.file_path = fs.JoinPath(pending.data_file_dir, delete_filename);
+			open_packs[pending.data_file_dir] = packs.size();
+			packs.push_back(std::move(pack));
+			entry = open_packs.find(pending.data_file_dir);
+		}
+		auto &pack = packs[entry->second];
+		pack.files.push_back(file_idx);
+		pack.size += blob_size;
+	}
+	return packs;
+}
+
+//! LSD radix sort over the bytes in use by the largest position. Positions within a data file are dense and
+//! bounded by its row count, so a few counting passes beat comparison sorting them (or inserting into a set).
+static void RadixSortPositions(vector<idx_t> &positions) {
+	static constexpr idx_t RADIX_SORT_THRESHOLD = 64;
+	if (positions.size() < RADIX_SORT_THRESHOLD) {
+		std::sort(positions.begin(), positions.end());
+		return;
+	}
+	auto max_value = *std::max_element(positions.begin(), positions.end());
+	vector<idx_t> buffer(positions.size());
+	auto source = &positions;
+	auto target = &buffer;
+	for (idx_t shift = 0; shift < 64 && (max_value >> shift) != 0; shift += 8) {
+		idx_t offsets[257] = {};
+		for (auto position : *source) {
+			offsets[((position >> shift) & 0xFF) + 1]++;
+		}
+		for (idx_t i = 1; i < 257; i++) {
+			offsets[i] += offsets[i - 1];
+		}
+		for (auto position : *source) {
+			(*target)[offsets[(position >> shift) & 0xFF]++] = position;
+		}
+		std::swap(source, target);
+	}
+	if (source != &positions) {
+		positions.swap(buffer);
 	}
 }
 
@@ -315,18 +412,24 @@ void IcebergDelete::FlushDeletes(IcebergTransaction &transaction, ClientContext
 	if (!multi_file_list) {
 		throw InternalException("IcebergDelete multi_file_list is NULL");
 	}
+	if (copy_on_write) {
+		RewriteDataFiles(context, global_state);
+		return;
+	}
 
-	lock_guard<mutex> guard(global_state.lock);
+	//! Only collecting the deletes from the global state and publishing the written files need the lock, the files
+	//! are written without holding it
+	unique_lock<mutex> guard(global_state.lock);
+	auto &fs = FileSystem::GetFileSystem(context);
+	vector<PendingDeleteFile> pending_files;
+	pending_files.reserve(global_state.deleted_rows.size());
 	for (auto &entry : global_state.deleted_rows) {
 		auto &filename = entry.first;
-		auto &deleted_rows = entry.second;
 
 		// sort and duplicate eliminate the deletes
-		set<idx_t> sorted_deletes;
-		for (auto &row_idx : deleted_rows) {
-			sorted_deletes.insert(row_idx);
-		}
-		if (sorted_deletes.size() != deleted_rows.size()) {
+		auto sorted_deletes = entry.second;
+		RadixSortPositions(sorted_deletes);
+		if (std::adjacent_find(sorted_deletes.begin(), sorted_deletes.end()) != sorted_deletes.end()) {
 			throw NotImplementedException("The same row was updated multiple times - this is not (yet) supported in "
 			                              "Iceberg. Eliminate duplicate matches prior to running the UPDATE");
 		}
@@ -336,7 +439,9 @@ void IcebergDelete::FlushDeletes(IcebergTransaction &transaction, ClientContext
 			if (existing_delete) {
 				auto &delete_data = *existing_delete;
 				PopulateAlteredManifests(*multi_file_list, global_state.altered_manifests, delete_data);
-				delete_data.ToSet(sorted_deletes);
+				delete_data.AppendPositions(sorted_deletes);
+				RadixSortPositions(sorted_deletes);
+				sorted_deletes.erase(std::unique(sorted_deletes.begin(), sorted_deletes.end()), sorted_deletes.end());
 			}
 		}
 
@@ -344,16 +449,6 @@ void IcebergDelete::FlushDeletes(IcebergTransaction &transaction, ClientContext
 		delete_file.data_file_path = filename;
 		delete_file.partition_info = multi_file_list->GetPartitionForDataFile(filename);
 
-		auto &fs = FileSystem::GetFileSystem(context);
-
-		string file_format;
-		if (write_deletion_vector) {
-			file_format = "puffin";
-		} else {
-			file_format = "parquet";
-		}
-
-		string delete_filename = UUID::ToString(UUID::GenerateRandomUUID()) + "-deletes." + file_format;
 		// Place the delete file in the same directory as the data file it references,
 		// so that for partitioned tables it lands in the correct partition folder.
 		auto sep = fs.PathSeparator(filename);
@@ -362,15 +457,319 @@ void IcebergDelete::FlushDeletes(IcebergTransaction &transaction, ClientContext
 			throw InvalidConfigurationException("Cannot create valid file path for delete file");
 		}
 		string data_file_dir = filename.substr(0, last_sep);
-		string delete_file_path = fs.JoinPath(data_file_dir, delete_filename);
+		if (!write_deletion_vector) {
+			string delete_filename = UUID::ToString(UUID::GenerateRandomUUID()) + "-deletes.parquet";
+			delete_file.file_name = fs.JoinPath(data_file_dir, delete_filename);
+		}
+		pending_files.push_back({filename, std::move(data_file_dir), std::move(delete_file), std::move(sorted_deletes),
+		                         IcebergDeletionVectorBlob()});
+	}
+	guard.unlock();
+
+	if (!write_deletion_vector) {
+		// every data file gets a delete file of its own, write them in parallel
+		IcebergUtils::RunIndexedTasks(context, pending_files.size(), [&](idx_t file_idx) {
+			auto &pending = pending_files[file_idx];
+			pending.delete_file =
+			    WritePositionalDeleteFile(context, pending.data_file_path, pending.delete_file, pending.sorted_deletes);
+		});
+	} else {
+		// serialize the deletion vectors in parallel, then pack the ones of the same directory into Puffin files
+		IcebergUtils::RunIndexedTasks(context, pending_files.size(), [&](idx_t file_idx) {
+			auto &pending = pending_files[file_idx];
+			pending.deletion_vector = CreateDeletionVectorBlob(pending.data_file_path, pending.sorted_deletes);
+		});
+		auto &table_metadata = table.table_info.table_metadata;
+		idx_t target_size = DEFAULT_DELETE_TARGET_FILE_SIZE;
+		auto target_size_property = table_metadata.GetTableProperty(WRITE_DELETE_TARGET_FILE_SIZE);
+		if (!target_size_property.empty()) {
+			target_size = IcebergUtils::ParseByteSizeOptionallyFormatted(target_size_property);
+		}
+		auto packs = PackDeletionVectors(fs, pending_files, target_size);
+		IcebergUtils::RunIndexedTasks(context, packs.size(), [&](idx_t pack_idx) {
+			WriteDeletionVectorFile(context, packs[pack_idx], pending_files);
+		});
+	}
 
-		delete_file.file_name = delete_file_path;
+	guard.lock();
+	for (auto &pending : pending_files) {
+		global_state.written_files.emplace(pending.data_file_path, std::move(pending.delete_file));
+	}
+}
 
-		if (!write_deletion_vector) {
-			WritePositionalDeleteFile(context, global_state, filename, delete_file, sorted_deletes);
-		} else {
-			WriteDeletionVectorFile(context, global_state, filename, delete_file, sorted_deletes);
+//===--------------------------------------------------------------------===//
+// Copy-on-write
+//===--------------------------------------------------------------------===//
+
+namespace {
+
+//! A data file with deleted rows, rewritten without them
+struct PendingRewriteFile {
+	//! The path the scan emitted for the data file
+	string data_file_path;
+	//! The directory of the data file, the rewritten file is written next to it
+	string data_file_dir;
+	//! The manifest entry of the data file, with its sequence number and first row id made explicit
+	IcebergManifestEntry original;
+	int32_t partition_spec_id;
+	//! Sorted and free of duplicates, includes the rows deleted by earlier deletes
+	vector<idx_t> sorted_deletes;
+	IcebergManifestEntry rewritten;
+};
+
+} // namespace
+
+//! The columns of the current schema, read by field id; with the '_row_id' of v3 tables, so it can be preserved
+static vector<MultiFileColumnDefinition> CreateRewriteScanSchema(const IcebergTableSchema &schema, bool read_row_id) {
+	vector<MultiFileColumnDefinition> result;
+	for (auto &column : schema.columns) {
+		result.push_back(column->GetMultiFileColumnDefinition());
+	}
+	if (read_row_id) {
+		MultiFileColumnDefinition row_id("_row_id", LogicalType::BIGINT);
+		row_id.identifier = Value::INTEGER(MultiFileReader::ROW_ID_FIELD_ID);
+		row_id.default_expression = make_uniq<ConstantExpression>(Value(LogicalType::BIGINT));
+		result.push_back(std::move(row_id));
+	}
+	return result;
+}
+
+//! Rows that have no materialized '_row_id' inherit it as 'first_row_id + pos', it has to be written out now that
+//! the rows move to a file with a different first_row_id and different positions
+static void MaterializeRowIds(Vector &row_ids, const Vector &row_numbers, int64_t first_row_id, idx_t count) {
+	UnifiedVectorFormat row_id_format;
+	row_ids.ToUnifiedFormat(count, row_id_format);
+	auto existing_row_ids = UnifiedVectorFormat::GetData<int64_t>(row_id_format);
+	auto positions = FlatVector::GetData<int64_t>(row_numbers);
+
+	Vector result(LogicalType::BIGINT, count);
+	auto result_data = FlatVector::GetDataMutable<int64_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = row_id_format.sel->get_index(i);
+		result_data[i] = row_id_format.validity.RowIsValid(idx) ? existing_row_ids[idx] : first_row_id + positions[i];
+	}
+	row_ids.Reference(result);
+}
+
+static vector<IcebergReturnColumnStats> GetReturnColumnStats(const CopyFunctionFileStatistics &stats) {
+	vector<IcebergReturnColumnStats> result;
+	for (auto &column : stats.column_statistics) {
+		IcebergReturnColumnStats column_stats;
+		column_stats.column_name = column.first;
+		for (auto &stat : column.second) {
+			column_stats.stats.push_back({stat.first, stat.second.ToString()});
 		}
+		result.push_back(std::move(column_stats));
+	}
+	return result;
+}
+
+//! Copy the rows of a data file that are not deleted into a new data file next to it
+static IcebergManifestEntry RewriteDataFile(ClientContext &context, const IcebergTableSchemaVersion &table,
+                                            const TableFunction &scan_function, const IcebergCopyOptions &copy_options,
+                                            const PendingRewriteFile &pending) {
+	auto &table_metadata = table.table_info.table_metadata;
+	auto &data_file = pending.original.data_file;
+	bool write_row_id = table_metadata.iceberg_version >= 3;
+
+	// scan the data file, with the position of every row
+	vector<OpenFileInfo> file_infos;
+	file_infos.emplace_back(pending.data_file_path);
+	auto &file_info = file_infos.back();
+	file_info.extended_info = make_shared_ptr<ExtendedOpenFileInfo>();
+	file_info.extended_info->options["file_size"] = Value::UBIGINT(data_file.file_size_in_bytes);
+	file_info.extended_info->options["validate_external_file_cache"] = Value::BOOLEAN(false);
+	file_info.extended_info->options["etag"] = Value("");
+	file_info.extended_info->options["last_modified"] = Value::TIMESTAMP(timestamp_t(0));
+
+	auto data_scan_function = scan_function;
+	data_scan_function.function_info = make_shared_ptr<IcebergDeleteScanInfo>(
+	    std::move(file_infos), CreateRewriteScanSchema(table_metadata.GetLatestSchema(), write_row_id));
+
+	vector<Value> children;
+	children.push_back(Value::LIST(LogicalType::VARCHAR, {Value(pending.data_file_path)}));
+	named_parameter_map_t named_params;
+	vector<LogicalType> input_types;
+	vector<Identifier> input_names;
+	TableFunctionRef empty;
+	TableFunctionBindInput bind_input(children, named_params, input_types, input_names, nullptr, nullptr,
+	                                  data_scan_function, empty);
+	vector<LogicalType> scan_types;
+	vector<Identifier> scan_names;
+	auto bind_data = data_scan_function.bind(context, bind_input, scan_types, scan_names);
+	data_scan_function.get_virtual_columns(context, bind_data.get());
+
+	vector<column_t> column_ids;
+	for (idx_t i = 0; i < scan_types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	column_ids.push_back(MultiFileReader::COLUMN_IDENTIFIER_FILE_ROW_NUMBER);
+	scan_types.push_back(LogicalType::BIGINT);
+	auto row_number_idx = scan_types.size() - 1;
+
+	ThreadContext thread_context(context);
+	ExecutionContext execution_context(context, thread_context, nullptr);
+	TableFunctionInitInput init_input(bind_data.get(), column_ids, vector<idx_t>(), nullptr);
+	auto scan_global_state = data_scan_function.init_global(context, init_input);
+	auto scan_local_state = data_scan_function.init_local(execution_context, init_input, scan_global_state.get());
+
+	// write the remaining rows, with the field ids and write properties of the table
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto file_path = fs.JoinPath(pending.data_file_dir, UUID::ToString(UUID::GenerateRandomUUID()) + ".parquet");
+	auto &copy_function = copy_options.copy_function;
+	auto &copy_bind_data = *copy_options.bind_data;
+	auto copy_global_state = copy_function.copy_to_initialize_global(context, copy_bind_data, file_path);
+	auto copy_local_state = copy_function.copy_to_initialize_local(execution_context, copy_bind_data);
+	CopyFunctionFileStatistics stats;
+	copy_function.copy_to_get_written_statistics(context, copy_bind_data, *copy_global_state, stats);
+
+	vector<column_t> write_column_ids;
+	for (idx_t i = 0; i < copy_options.expected_types.size(); i++) {
+		write_column_ids.push_back(i);
+	}
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(context, scan_types);
+	DataChunk write_chunk;
+	write_chunk.InitializeEmpty(copy_options.expected_types);
+	SelectionVector live_rows(STANDARD_VECTOR_SIZE);
+	auto &sorted_deletes = pending.sorted_deletes;
+	while (true) {
+		scan_chunk.Reset();
+		TableFunctionInput function_input(bind_data.get(), scan_local_state.get(), scan_global_state.get());
+		data_scan_function.function(context, function_input, scan_chunk);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		scan_chunk.Flatten();
+		auto &row_numbers = scan_chunk.data[row_number_idx];
+		if (write_row_id && data_file.HasFirstRowId()) {
+			MaterializeRowIds(scan_chunk.data[row_number_idx - 1], row_numbers, data_file.GetFirstRowId(),
+			                  scan_chunk.size());
+		}
+		auto positions = FlatVector::GetData<int64_t>(row_numbers);
+		idx_t live_count = 0;
+		for (idx_t i = 0; i < scan_chunk.size(); i++) {
+			auto position = NumericCast<idx_t>(positions[i]);
+			if (!std::binary_search(sorted_deletes.begin(), sorted_deletes.end(), position)) {
+				live_rows.set_index(live_count++, i);
+			}
+		}
+		if (live_count == 0) {
+			continue;
+		}
+		if (live_count < scan_chunk.size()) {
+			scan_chunk.Slice(live_rows, live_count);
+		}
+		write_chunk.ReferenceColumns(scan_chunk, write_column_ids);
+		copy_function.copy_to_sink(execution_context, copy_bind_data, *copy_global_state, *copy_local_state,
+		                           write_chunk);
+	}
+	copy_function.copy_to_combine(execution_context, copy_bind_data, *copy_global_state, *copy_local_state);
+	copy_function.copy_to_finalize(context, copy_bind_data, *copy_global_state);
+
+	IcebergManifestEntry result;
+	result.status = IcebergManifestEntryStatusType::ADDED;
+	//! Keep the data sequence number of the file that is replaced, equality deletes that applied to its rows
+	//! still have to apply to them
+	result.SetSequenceNumber(pending.original.ExplicitSequenceNumber());
+	auto &new_file = result.data_file;
+	new_file.file_path = file_path;
+	new_file.content = IcebergManifestEntryContentType::DATA;
+	new_file.file_format = "parquet";
+	new_file.record_count = NumericCast<int64_t>(stats.row_count);
+	new_file.file_size_in_bytes = NumericCast<int64_t>(stats.file_size_bytes);
+	new_file.partition_info = data_file.partition_info;
+	new_file.sort_order_id = data_file.sort_order_id;
+	IcebergDataFileStats file_stats(context, table_metadata, table.name.GetIdentifierName());
+	file_stats.PopulateFromReturnStats(new_file, GetReturnColumnStats(stats));
+	DUCKDB_LOG(context, IcebergLogType,
+	           "Iceberg DELETE, rewrote data_file '%s' as '%s' (copy-on-write), record_count=%lld, file_size=%lld "
+	           "bytes",
+	           pending.data_file_path, file_path, new_file.record_count, new_file.file_size_in_bytes);
+	return result;
+}
+
+void IcebergDelete::RewriteDataFiles(ClientContext &context, IcebergDeleteGlobalState &global_state) const {
+	//! Only collecting the data files to rewrite and publishing the rewritten files need the lock, the files are
+	//! rewritten without holding it
+	unique_lock<mutex> guard(global_state.lock);
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto &table_metadata = table.table_info.table_metadata;
+
+	unordered_set<string> data_file_paths;
+	for (auto &entry : global_state.deleted_rows) {
+		data_file_paths.insert(entry.first);
+	}
+	auto data_file_entries = multi_file_list->GetEntriesForDataFiles(data_file_paths);
+
+	vector<PendingRewriteFile> pending_files;
+	for (auto &entry : global_state.deleted_rows) {
+		auto &filename = entry.first;
+
+		// sort and duplicate eliminate the deletes
+		auto sorted_deletes = entry.second;
+		RadixSortPositions(sorted_deletes);
+		if (std::adjacent_find(sorted_deletes.begin(), sorted_deletes.end()) != sorted_deletes.end()) {
+			throw NotImplementedException("The same row was updated multiple times - this is not (yet) supported in "
+			                              "Iceberg. Eliminate duplicate matches prior to running the UPDATE");
+		}
+		//! The rewritten file has a path of its own, the deletes of the original file no longer apply to it: leave
+		//! out the rows they delete as well
+		auto existing_delete = multi_file_list->GetExistingPositionalDeleteData(filename);
+		if (existing_delete) {
+			auto &delete_data = *existing_delete;
+			PopulateAlteredManifests(*multi_file_list, global_state.altered_manifests, delete_data);
+			delete_data.AppendPositions(sorted_deletes);
+			RadixSortPositions(sorted_deletes);
+			sorted_deletes.erase(std::unique(sorted_deletes.begin(), sorted_deletes.end()), sorted_deletes.end());
+		}
+
+		auto &original_entry = data_file_entries.at(filename);
+		auto &original = original_entry.entry;
+		global_state.altered_manifests.InvalidateEntry(original.data_file, original_entry.manifest);
+		if (NumericCast<idx_t>(original.data_file.record_count) <= sorted_deletes.size()) {
+			// every row is deleted, the data file is removed without a replacement
+			DUCKDB_LOG(context, IcebergLogType, "Iceberg DELETE, removed data_file '%s' (copy-on-write)", filename);
+			continue;
+		}
+
+		auto sep = fs.PathSeparator(filename);
+		auto last_sep = filename.rfind(sep);
+		if (last_sep == string::npos) {
+			throw InvalidConfigurationException("Cannot create valid file path for rewritten data file");
+		}
+		PendingRewriteFile pending;
+		pending.data_file_path = filename;
+		pending.data_file_dir = filename.substr(0, last_sep);
+		pending.original = std::move(original);
+		pending.partition_spec_id = multi_file_list->GetPartitionForDataFile(filename).partition_spec_id;
+		pending.sorted_deletes = std::move(sorted_deletes);
+		pending_files.push_back(std::move(pending));
+	}
+	guard.unlock();
+	if (pending_files.empty()) {
+		return;
+	}
+
+	//! The rows keep the partition of the file they are copied from, so no partitioning is applied on write
+	auto &schema = table_metadata.GetLatestSchema();
+	IcebergCopyInput copy_input(context, table_metadata, schema);
+	copy_input.partition_spec = nullptr;
+	if (table_metadata.iceberg_version >= 3) {
+		copy_input.virtual_columns = IcebergInsertVirtualColumns::WRITE_ROW_ID;
+	}
+	auto copy_options = IcebergInsert::GetCopyOptions(context, copy_input);
+	auto scan_functions = IcebergFunctions::GetIcebergDeletesScanFunction(context);
+	auto scan_function = scan_functions.GetFunctionByArguments(context, {LogicalType::LIST(LogicalType::VARCHAR)});
+
+	// every data file is rewritten by a task of its own
+	IcebergUtils::RunIndexedTasks(context, pending_files.size(), [&](idx_t file_idx) {
+		auto &pending = pending_files[file_idx];
+		pending.rewritten = RewriteDataFile(context, table, scan_function, copy_options, pending);
+	});
+	guard.lock();
+	for (auto &pending : pending_files) {
+		global_state.rewritten_files[pending.partition_spec_id].push_back(std::move(pending.rewritten));
 	}
 }
 
@@ -398,10 +797,7 @@ partitioned_manifest_entry_map_t IcebergDelete::GenerateDeleteManifestEntries(Ic
 			data_file.file_size_in_bytes = delete_file.file_size_bytes;
 			data_file.equality_ids = delete_file.equality_ids;
 			//! Record the equality-delete metrics so the file can be pruned safely.
-			data_file.lower_bounds = delete_file.lower_bounds;
-			data_file.upper_bounds = delete_file.upper_bounds;
-			data_file.null_value_counts = delete_file.null_value_counts;
-			data_file.nan_value_counts = delete_file.nan_value_counts;
+			data_file.column_stats = delete_file.column_stats;
 			iceberg_delete_files[delete_file.partition_info.partition_spec_id].push_back(manifest_entry);
 			continue;
 		}
@@ -419,8 +815,10 @@ partitioned_manifest_entry_map_t IcebergDelete::GenerateDeleteManifestEntries(Ic
 		}
 
 		// set lower and upper bound for the filename column
-		data_file.lower_bounds[MultiFileReader::FILENAME_FIELD_ID] = Value::BLOB(data_file_name);
-		data_file.upper_bounds[MultiFileReader::FILENAME_FIELD_ID] = Value::BLOB(data_file_name);
+		data_file.column_stats.SetBound(IcebergColumnStatType::LOWER_BOUND, MultiFileReader::FILENAME_FIELD_ID,
+		                                string_t(data_file_name));
+		data_file.column_stats.SetBound(IcebergColumnStatType::UPPER_BOUND, MultiFileReader::FILENAME_FIELD_ID,
+		                                string_t(data_file_name));
 		// set referenced_data_file
 		data_file.referenced_data_file = data_file_name;
 		// copy partition info from the data file being deleted
@@ -465,6 +863,15 @@ SinkFinalizeType IcebergDelete::Finalize(Pipeline &pipeline, Event &event, Clien
 	auto &irc_table = table.Cast<IcebergTableSchemaVersion>();
 
 	auto &table_info = irc_table.table_info;
+	if (copy_on_write) {
+		// the data files were rewritten, replace the originals by them
+		ApplyTableUpdate(table_info, iceberg_transaction, [&](IcebergTable &tbl) {
+			auto &transaction_data = tbl.GetOrCreateTransactionData(iceberg_transaction);
+			transaction_data.AddOverwriteSnapshot(std::move(global_state.rewritten_files),
+			                                      std::move(global_state.altered_manifests));
+		});
+		return SinkFinalizeType::READY;
+	}
 	auto iceberg_delete_files = GenerateDeleteManifestEntries(global_state);
 
 	if (!global_state.written_files.empty()) {
@@ -504,7 +911,7 @@ InsertionOrderPreservingMap<string> IcebergDelete::ParamsToString() const {
 
 PhysicalOperator &IcebergDelete::PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner,
                                             IcebergTableSchemaVersion &table, PhysicalOperator &child_plan,
-                                            vector<idx_t> &&row_id_indexes) {
+                                            vector<idx_t> &&row_id_indexes, bool copy_on_write) {
 	auto scan = FindIcebergScan(child_plan);
 
 	optional_ptr<IcebergMultiFileList> multi_file_list;
@@ -517,12 +924,16 @@ PhysicalOperator &IcebergDelete::PlanDelete(ClientContext &context, PhysicalPlan
 
 #ifdef ICEBERG_ENABLE_EQUALITY_DELETE_WRITES
 	vector<IcebergEqualityDeletePredicate> equality_predicates;
-	bool is_equality_delete = TryGetEqualityDeletePredicates(context, table, child_plan, equality_predicates);
-	return planner.Make<IcebergDelete>(table, multi_file_list, child_plan, std::move(row_id_indexes),
-	                                   is_equality_delete, std::move(equality_predicates));
+	//! A copy-on-write delete writes no delete files at all
+	bool is_equality_delete =
+	    !copy_on_write && TryGetEqualityDeletePredicates(context, table, child_plan, equality_predicates);
+	auto &result = planner.Make<IcebergDelete>(table, multi_file_list, child_plan, std::move(row_id_indexes),
+	                                           is_equality_delete, std::move(equality_predicates));
 #else
-	return planner.Make<IcebergDelete>(table, multi_file_list, child_plan, std::move(row_id_indexes));
+	auto &result = planner.Make<IcebergDelete>(table, multi_file_list, child_plan, std::move(row_id_indexes));
 #endif
+	result.Cast<IcebergDelete>().copy_on_write = copy_on_write;
+	return result;
 }
 
 PhysicalOperator &IcebergCatalog::PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner, LogicalDelete &op,
@@ -563,17 +974,17 @@ PhysicalOperator &IcebergCatalog::PlanDeleteOperation(ClientContext &context, Ph
 		row_id_indexes.push_back(bound_ref.Index());
 	}
 
-	auto allows_positional_deletes = updated_table_entry.table_info.table_metadata.PropertiesAllowPositionalDeletes(
-	    IcebergSnapshotOperationType::DELETE);
-	if (!allows_positional_deletes) {
-		auto delete_table_property = updated_table_entry.table_info.table_metadata.GetTableProperty(WRITE_DELETE_MODE);
-		auto error_message = IcebergCatalog::GetOnlyMergeOnReadSupportedErrorMessage(
+	auto &updated_metadata = updated_table_entry.table_info.table_metadata;
+	auto copy_on_write = updated_metadata.PropertiesRequireCopyOnWrite(IcebergSnapshotOperationType::DELETE);
+	if (!copy_on_write && !updated_metadata.PropertiesAllowPositionalDeletes(IcebergSnapshotOperationType::DELETE)) {
+		auto delete_table_property = updated_metadata.GetTableProperty(WRITE_DELETE_MODE);
+		auto error_message = IcebergCatalog::GetUnsupportedWriteModeErrorMessage(
 		    updated_table_entry.name.GetIdentifierName(), WRITE_DELETE_MODE, delete_table_property);
 		throw NotImplementedException(error_message);
 	}
 
-	auto &iceberg_delete =
-	    IcebergDelete::PlanDelete(context, planner, updated_table_entry, plan, std::move(row_id_indexes));
+	auto &iceberg_delete = IcebergDelete::PlanDelete(context, planner, updated_table_entry, plan,
+	                                                 std::move(row_id_indexes), copy_on_write);
 	return iceberg_delete;
 }
 
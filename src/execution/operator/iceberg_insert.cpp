@@ -19,6 +19,7 @@
 #include "duckdb/planner/bound_result_modifier.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/numeric_utils.hpp"
 
 #include "catalog/rest/iceberg_catalog.hpp"
 #include "catalog/rest/catalog_entry/table/iceberg_table_schema_version.hpp"
@@ -147,101 +148,168 @@ static bool CanWriteIdentityPartitionsDirectly(const IcebergPartitionSpec &spec,
 	return true;
 }
 
-void IcebergInsertGlobalState::AddFiles(DataChunk &chunk, const string &table_name,
-                                        const IcebergTableMetadata &table_metadata) {
-	// grab lock for written files vector
-	lock_guard<mutex> guard(lock);
-	for (idx_t r = 0; r < chunk.size(); r++) {
-		IcebergManifestEntry manifest_entry;
-		manifest_entry.status = IcebergManifestEntryStatusType::ADDED;
+IcebergWrittenFileDecoder::IcebergWrittenFileDecoder(ClientContext &context, const string &table_name,
+                                                     const IcebergTableMetadata &table_metadata)
+    : table_metadata(table_metadata), context(context), data_file_stats(context, table_metadata, table_name) {
+	auto &ic_schema = table_metadata.GetSchemas().at(table_metadata.GetCurrentSchemaId());
+	auto &ic_partition_info = table_metadata.GetLatestPartitionSpec();
+
+	// this is a weird case with partitioned inserts.
+	// Lakekeeper requires paritition fields to not have the same names as the columns (if there is a transform)
+	// So now our partition field names always include the transform name
+	// But if there are only identity transforms, we don't add a projection to the insert, so we can just use
+	// regular column names. So here when we populate our map, if there are transforms present, we need to use our
+	// transform partition column names. If not, we should use the identify names.
+	if (!CanWriteIdentityPartitionsDirectly(ic_partition_info, *ic_schema)) {
+		for (auto &partition_field : ic_partition_info.fields) {
+			partition_colname_to_field.emplace(partition_field.GetPartitionSpecFieldName(), partition_field);
+		}
+	} else {
+		for (auto &partition_field : ic_partition_info.fields) {
+			auto actual_col_name = GetColumnNameBySourceId(*ic_schema, partition_field.source_id);
+			partition_colname_to_field.emplace(actual_col_name, partition_field);
+		}
+	}
+	if (table_metadata.HasSortOrder()) {
+		auto &sort_order = table_metadata.GetLatestSortOrder();
+		if (sort_order.IsSorted()) {
+			sort_order_id = sort_order.sort_order_id;
+		}
+	}
+}
 
-		// returned chunk has data as defined in
-		// GetCopyFunctionReturnLogicalTypes(CopyFunctionReturnType::WRITTEN_FILE_STATISTICS)
-		auto &data_file = manifest_entry.data_file;
-		data_file.file_path = chunk.GetValue(0, r).GetValue<string>();
-		data_file.record_count = static_cast<int64_t>(chunk.GetValue(1, r).GetValue<idx_t>());
-		data_file.file_size_in_bytes = static_cast<int64_t>(chunk.GetValue(2, r).GetValue<idx_t>());
-		data_file.content = IcebergManifestEntryContentType::DATA;
-		data_file.file_format = "parquet";
+namespace {
 
-		// extract the column stats
-		auto column_stats = chunk.GetValue(4, r);
+//! The unified format of a MAP(VARCHAR, V) vector, the entries are the (key, value) struct children of the list
+struct UnifiedMapFormat {
+	explicit UnifiedMapFormat(const RecursiveUnifiedVectorFormat &format)
+	    : lists(format.unified), keys(format.children[0].children[0].unified),
+	      values(format.children[0].children[1]) {
+	}
 
-		// column 5 is stats, which we can also use for partition information
-		auto partition_values = chunk.GetValue(5, r);
+	//! Returns false if the map of 'row' is NULL
+	bool GetEntry(idx_t row, list_entry_t &entry) const {
+		auto list_idx = lists.sel->get_index(row);
+		if (!lists.validity.RowIsValid(list_idx)) {
+			return false;
+		}
+		entry = UnifiedVectorFormat::GetData<list_entry_t>(lists)[list_idx];
+		return true;
+	}
+	string GetKey(idx_t child_idx) const {
+		return GetString(keys, child_idx);
+	}
 
-		auto table_current_schema_id = table_metadata.GetCurrentSchemaId();
-		auto &ic_schema = table_metadata.GetSchemas().at(table_current_schema_id);
+	static bool IsNull(const UnifiedVectorFormat &format, idx_t row) {
+		return !format.validity.RowIsValid(format.sel->get_index(row));
+	}
+	static string GetString(const UnifiedVectorFormat &format, idx_t row) {
+		return UnifiedVectorFormat::GetData<string_t>(format)[format.sel->get_index(row)].GetString();
+	}
 
-		auto ic_partition_info = table_metadata.GetLatestPartitionSpec();
+	const UnifiedVectorFormat &lists;
+	const UnifiedVectorFormat &keys;
+	const RecursiveUnifiedVectorFormat &values;
+};
 
-		// Build a map from partition column name to its partition spec field
-		// To be used later to add partitioning info to the data file
-		case_insensitive_map_t<reference<const IcebergPartitionSpecField>> partition_colname_to_field;
+} // namespace
 
-		// this is a weird case with partitioned inserts.
-		// Lakekeeper requires paritition fields to not have the same names as the columns (if there is a transform)
-		// So now our partition field names always include the transform name
-		// But if there are only identity transforms, we don't add a projection to the insert, so we can just use
-		// regular column names. So here when we populate our map, if there are transforms present, we need to use our
-		// transform partition column names. If not, we should use the identify names.
-		if (!CanWriteIdentityPartitionsDirectly(ic_partition_info, *ic_schema)) {
-			for (auto &partition_field : ic_partition_info.fields) {
-				partition_colname_to_field.emplace(partition_field.GetPartitionSpecFieldName(), partition_field);
-			}
-		} else {
-			for (auto &partition_field : ic_partition_info.fields) {
-				auto actual_col_name = GetColumnNameBySourceId(*ic_schema, partition_field.source_id);
-				partition_colname_to_field.emplace(actual_col_name, partition_field);
-			}
-		}
+idx_t IcebergWrittenFileDecoder::Decode(DataChunk &chunk, vector<IcebergManifestEntry> &result) {
+	// returned chunk has data as defined in
+	// GetCopyFunctionReturnLogicalTypes(CopyFunctionReturnType::WRITTEN_FILE_STATISTICS)
+	UnifiedVectorFormat path_format;
+	UnifiedVectorFormat count_format;
+	UnifiedVectorFormat size_format;
+	chunk.data[0].ToUnifiedFormat(path_format);
+	chunk.data[1].ToUnifiedFormat(count_format);
+	chunk.data[2].ToUnifiedFormat(size_format);
+	auto record_counts = UnifiedVectorFormat::GetData<uint64_t>(count_format);
+	auto file_sizes = UnifiedVectorFormat::GetData<uint64_t>(size_format);
+
+	// column 4 holds the column stats: MAP(VARCHAR, MAP(VARCHAR, VARCHAR))
+	RecursiveUnifiedVectorFormat stats_format;
+	Vector::RecursiveToUnifiedFormat(chunk.data[4], stats_format);
+	UnifiedMapFormat column_stats_map(stats_format);
+	UnifiedMapFormat stat_map(column_stats_map.values);
+	auto &stat_values = stat_map.values.unified;
+
+	// column 5 holds the partition values: MAP(VARCHAR, VARCHAR)
+	RecursiveUnifiedVectorFormat partition_format;
+	Vector::RecursiveToUnifiedFormat(chunk.data[5], partition_format);
+	UnifiedMapFormat partition_map(partition_format);
+	auto &partition_values = partition_map.values.unified;
+
+	idx_t record_count = 0;
+	result.reserve(result.size() + chunk.size());
+	for (idx_t r = 0; r < chunk.size(); r++) {
+		IcebergManifestEntry manifest_entry;
+		manifest_entry.status = IcebergManifestEntryStatusType::ADDED;
 
-		if (!partition_values.IsNull()) {
-			// Populate partition_info from the partition values in the chunk
-			auto &partition_children = MapValue::GetChildren(partition_values);
-			for (auto &partition_val : partition_children) {
-				auto &struct_val = StructValue::GetChildren(partition_val);
-				auto &partition_name = StringValue::Get(struct_val[0]);
+		auto &data_file = manifest_entry.data_file;
+		data_file.file_path = UnifiedMapFormat::GetString(path_format, r);
+		data_file.record_count = NumericCast<int64_t>(record_counts[count_format.sel->get_index(r)]);
+		data_file.file_size_in_bytes = NumericCast<int64_t>(file_sizes[size_format.sel->get_index(r)]);
+		data_file.content = IcebergManifestEntryContentType::DATA;
+		data_file.file_format = "parquet";
+		data_file.sort_order_id = sort_order_id;
 
-				auto field_it = partition_colname_to_field.find(partition_name);
+		list_entry_t partition_entry;
+		if (partition_map.GetEntry(r, partition_entry)) {
+			for (idx_t i = partition_entry.offset; i < partition_entry.offset + partition_entry.length; i++) {
+				auto field_it = partition_colname_to_field.find(partition_map.GetKey(i));
 				D_ASSERT(field_it != partition_colname_to_field.end());
 				auto &partition_field = field_it->second.get();
-				auto source_type = ic_schema->GetColumnTypeFromFieldId(partition_field.source_id);
 
 				IcebergPartitionInfo info;
 				info.field_id = partition_field.partition_field_id;
-				if (!struct_val[1].IsNull()) {
-					info.value = Value(StringValue::Get(struct_val[1]));
-				} else {
-					info.value = Value();
+				if (!UnifiedMapFormat::IsNull(partition_values, i)) {
+					info.value = Value(UnifiedMapFormat::GetString(partition_values, i));
 				}
 				data_file.partition_info.push_back(std::move(info));
 			}
 		}
-		if (table_metadata.HasSortOrder()) {
-			auto &sort_order = table_metadata.GetLatestSortOrder();
-			if (sort_order.IsSorted()) {
-				data_file.sort_order_id = sort_order.sort_order_id;
+
+		list_entry_t columns_entry;
+		column_stats.clear();
+		if (column_stats_map.GetEntry(r, columns_entry)) {
+			for (idx_t c = columns_entry.offset; c < columns_entry.offset + columns_entry.length; c++) {
+				IcebergReturnColumnStats returned_column;
+				returned_column.column_name = column_stats_map.GetKey(c);
+				list_entry_t stats_entry;
+				if (stat_map.GetEntry(c, stats_entry)) {
+					for (idx_t s = stats_entry.offset; s < stats_entry.offset + stats_entry.length; s++) {
+						IcebergReturnStat stat;
+						stat.name = stat_map.GetKey(s);
+						stat.value = UnifiedMapFormat::GetString(stat_values, s);
+						returned_column.stats.push_back(std::move(stat));
+					}
+				}
+				column_stats.push_back(std::move(returned_column));
 			}
+			data_file_stats.PopulateFromReturnStats(data_file, column_stats);
 		}
 
-		insert_count += data_file.record_count;
-
-		IcebergDataFileStats::PopulateFromReturnStats(context, data_file, column_stats, table_metadata, table_name);
+		record_count += NumericCast<idx_t>(data_file.record_count);
 		DUCKDB_LOG(context, IcebergLogType,
 		           "Iceberg INSERT, wrote data_file '%s', record_count=%lld, file_size=%lld bytes", data_file.file_path,
 		           data_file.record_count, data_file.file_size_in_bytes);
+		result.push_back(std::move(manifest_entry));
+	}
+	return record_count;
+}
 
-		written_files.push_back(std::move(manifest_entry));
+void IcebergInsertGlobalState::AddFiles(DataChunk &chunk, const string &table_name,
+                                        const IcebergTableMetadata &table_metadata) {
+	// grab lock for written files vector
+	lock_guard<mutex> guard(lock);
+	if (!decoder || &decoder->table_metadata != &table_metadata) {
+		decoder = make_uniq<IcebergWrittenFileDecoder>(context, table_name, table_metadata);
 	}
+	insert_count += decoder->Decode(chunk, written_files);
 }
 
-void IcebergInsert::AddWrittenFiles(IcebergInsertGlobalState &global_state, DataChunk &chunk,
-                                    optional_ptr<TableCatalogEntry> table) {
-	D_ASSERT(table);
-	auto &ic_table = table->Cast<IcebergTableSchemaVersion>();
-	auto &table_metadata = ic_table.table_info.table_metadata;
-	global_state.AddFiles(chunk, ic_table.name.GetIdentifierName(), table_metadata);
+unique_ptr<LocalSinkState> IcebergInsert::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<IcebergInsertLocalState>();
 }
 
 optional_ptr<TableCatalogEntry> IcebergInsert::GetEffectiveTable() const {
@@ -256,18 +324,39 @@ optional_ptr<TableCatalogEntry> IcebergInsert::GetEffectiveTable() const {
 }
 
 SinkResultType IcebergInsert::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
-	auto &global_state = input.global_state.Cast<IcebergInsertGlobalState>();
-
-	// For CTAS, `table` is null at planning time and the catalog entry is
-	// produced by an upstream PhysicalIcebergCreateTable on the first chunk.
-	// By the time Sink runs that upstream operator has already populated
-	// `create_state->table_entry`, so resolve the effective table here.
-	auto effective_table = GetEffectiveTable();
-	AddWrittenFiles(global_state, chunk, effective_table);
+	auto &local_state = input.local_state.Cast<IcebergInsertLocalState>();
+
+	if (!local_state.decoder) {
+		// For CTAS, `table` is null at planning time and the catalog entry is
+		// produced by an upstream PhysicalIcebergCreateTable on the first chunk.
+		// By the time Sink runs that upstream operator has already populated
+		// `create_state->table_entry`, so resolve the effective table here.
+		auto effective_table = GetEffectiveTable();
+		D_ASSERT(effective_table);
+		auto &ic_table = effective_table->Cast<IcebergTableSchemaVersion>();
+		local_state.decoder = make_uniq<IcebergWrittenFileDecoder>(
+		    context.client, ic_table.name.GetIdentifierName(), ic_table.table_info.table_metadata);
+	}
+	local_state.insert_count += local_state.decoder->Decode(chunk, local_state.written_files);
 
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkCombineResultType IcebergInsert::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &global_state = input.global_state.Cast<IcebergInsertGlobalState>();
+	auto &local_state = input.local_state.Cast<IcebergInsertLocalState>();
+	if (local_state.written_files.empty()) {
+		return SinkCombineResultType::FINISHED;
+	}
+	lock_guard<mutex> guard(global_state.lock);
+	auto &written_files = global_state.written_files;
+	written_files.insert(written_files.end(), std::make_move_iterator(local_state.written_files.begin()),
+	                     std::make_move_iterator(local_state.written_files.end()));
+	global_state.insert_count += local_state.insert_count;
+	local_state.written_files.clear();
+	return SinkCombineResultType::FINISHED;
+}
+
 //===--------------------------------------------------------------------===//
 // GetData
 //===--------------------------------------------------------------------===//
@@ -311,7 +400,8 @@ SinkFinalizeType IcebergInsert::Finalize(Pipeline &pipeline, Event &event, Clien
 			ApplyTableUpdate(table_info, iceberg_transaction, [&](IcebergTable &tbl) {
 				auto &transaction_data = tbl.GetOrCreateTransactionData(iceberg_transaction);
 				transaction_data.AddUpdateSnapshot(std::move(delete_manifest_entries), std::move(written_files),
-				                                   std::move(delete_global_state.altered_manifests));
+				                                   std::move(delete_global_state.altered_manifests),
+				                                   std::move(delete_global_state.rewritten_files));
 			});
 		}
 	} else {
@@ -604,8 +694,56 @@ static const IcebergParquetOptionMapping ICEBERG_TABLE_PROPERTY_MAPPING[] = {
 static const idx_t ICEBERG_TABLE_PROPERTY_MAPPING_SIZE =
     sizeof(ICEBERG_TABLE_PROPERTY_MAPPING) / sizeof(IcebergParquetOptionMapping);
 
+static constexpr const char *BLOOM_FILTER_ENABLED_PREFIX = "write.parquet.bloom-filter-enabled.column.";
+static constexpr const char *BLOOM_FILTER_FPP_PREFIX = "write.parquet.bloom-filter-fpp.column.";
+//! Iceberg's default for write.parquet.bloom-filter-fpp.column.<col>
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
+
 } // namespace
 
+//! Iceberg enables bloom filters per column, while DuckDB's parquet writer has a single switch and false positive
+//! ratio for the whole file (and only writes bloom filters for dictionary encoded columns).
+//! Bloom filters are written as soon as one column enables them, using the lowest ratio any of those columns asks
+//! for. They are only turned off when columns disable them and none enables them.
+static void MapBloomFilterProperties(const case_insensitive_map_t<string> &table_properties, CopyInfo &info) {
+	case_insensitive_map_t<bool> enabled_columns;
+	case_insensitive_map_t<double> column_fpp;
+	for (auto &property : table_properties) {
+		if (StringUtil::StartsWith(property.first, BLOOM_FILTER_ENABLED_PREFIX)) {
+			auto column_name = property.first.substr(strlen(BLOOM_FILTER_ENABLED_PREFIX));
+			enabled_columns[column_name] =
+			    Value(property.second).DefaultCastAs(LogicalType::BOOLEAN).GetValue<bool>();
+		} else if (StringUtil::StartsWith(property.first, BLOOM_FILTER_FPP_PREFIX)) {
+			auto column_name = property.first.substr(strlen(BLOOM_FILTER_FPP_PREFIX));
+			auto fpp = Value(property.second).DefaultCastAs(LogicalType::DOUBLE).GetValue<double>();
+			if (fpp <= 0 || fpp >= 1) {
+				throw InvalidConfigurationException("Invalid value '%s' for table property '%s', expected a ratio "
+				                                    "between 0 and 1",
+				                                    property.second, property.first);
+			}
+			column_fpp[column_name] = fpp;
+		}
+	}
+	if (enabled_columns.empty()) {
+		return;
+	}
+	bool write_bloom_filter = false;
+	double false_positive_ratio = 1;
+	for (auto &column : enabled_columns) {
+		if (!column.second) {
+			continue;
+		}
+		write_bloom_filter = true;
+		auto fpp = column_fpp.find(column.first);
+		false_positive_ratio = MinValue(false_positive_ratio,
+		                                fpp == column_fpp.end() ? DEFAULT_BLOOM_FILTER_FPP : fpp->second);
+	}
+	info.options["write_bloom_filter"].emplace_back(Value::BOOLEAN(write_bloom_filter));
+	if (write_bloom_filter) {
+		info.options["bloom_filter_false_positive_ratio"].emplace_back(Value::DOUBLE(false_positive_ratio));
+	}
+}
+
 IcebergCopyOptions IcebergInsert::GetCopyOptions(ClientContext &context, const IcebergCopyInput &copy_input) {
 	auto info = make_uniq<CopyInfo>();
 	info->file_path = copy_input.data_path;
@@ -625,9 +763,6 @@ IcebergCopyOptions IcebergInsert::GetCopyOptions(ClientContext &context, const I
 	// Map Iceberg write properties to DuckDB parquet copy options
 	optional_idx batch_size;
 	optional_idx batch_size_bytes;
-	// TODO: Iceberg properties for bloom filter are per column, duckdb's seems to be per table.
-	// write.parquet.bloom-filter-fpp.column.<col> -> bloom_filter_false_positive_ratio
-	// write.parquet.bloom-filter-enabled.column.<col> -> write_bloom_filter
 	for (idx_t i = 0; i < ICEBERG_TABLE_PROPERTY_MAPPING_SIZE; i++) {
 		auto &mapping = ICEBERG_TABLE_PROPERTY_MAPPING[i];
 		auto it = table_properties.find(mapping.iceberg_option);
@@ -646,6 +781,7 @@ IcebergCopyOptions IcebergInsert::GetCopyOptions(ClientContext &context, const I
 		}
 		info->options[mapping.parquet_option].emplace_back(it->second);
 	}
+	MapBloomFilterProperties(table_properties, *info);
 
 	// Always use native parquet geometry for writing
 	info->options["geoparquet_version"].emplace_back("NONE");
@@ -778,6 +914,21 @@ static void GeneratePhysicalOrder(PhysicalPlanGenerator &planner, vector<BoundOr
 	plan = order;
 }
 
+//! Prepend the partition columns to the sort order, so the rows of each partition reach the partitioned copy grouped
+//! together and in the table's sort order
+static void AddPartitionOrderColumns(const PhysicalOperator &plan, IcebergCopyOptions &copy_options) {
+	auto &types = plan.GetTypes();
+	vector<BoundOrderByNode> orders;
+	for (auto partition_column : copy_options.partition_columns) {
+		auto expr = make_uniq<BoundReferenceExpression>(types[partition_column], partition_column);
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(expr));
+	}
+	for (auto &order : copy_options.order_columns) {
+		orders.push_back(std::move(order));
+	}
+	copy_options.order_columns = std::move(orders);
+}
+
 PhysicalOperator &IcebergInsert::PlanCopyForInsert(ClientContext &context, PhysicalPlanGenerator &planner,
                                                    const IcebergCopyInput &copy_input,
                                                    optional_ptr<PhysicalOperator> plan) {
@@ -789,7 +940,10 @@ PhysicalOperator &IcebergInsert::PlanCopyForInsert(ClientContext &context, Physi
 		GenerateProjection(context, planner, copy_options.projection_list, plan);
 	}
 
-	if (!copy_input.partition_spec && !copy_options.order_columns.empty() && plan) {
+	if (!copy_options.order_columns.empty() && plan) {
+		if (copy_input.partition_spec) {
+			AddPartitionOrderColumns(*plan, copy_options);
+		}
 		GeneratePhysicalOrder(planner, copy_options.order_columns, plan);
 	}
 
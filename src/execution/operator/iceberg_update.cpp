@@ -51,8 +51,17 @@ IcebergUpdate &IcebergUpdate::PlanUpdateOperator(ClientContext &context, Physica
 		throw NotImplementedException("Update Iceberg V%d tables", table_metadata.iceberg_version);
 	}
 
+	auto copy_on_write = table_metadata.PropertiesRequireCopyOnWrite(IcebergSnapshotOperationType::OVERWRITE);
+	if (!copy_on_write && !table_metadata.PropertiesAllowPositionalDeletes(IcebergSnapshotOperationType::OVERWRITE)) {
+		auto update_table_property = table_metadata.GetTableProperty(WRITE_UPDATE_MODE);
+		auto error_message = IcebergCatalog::GetUnsupportedWriteModeErrorMessage(
+		    table.name.GetIdentifierName(), WRITE_UPDATE_MODE, update_table_property);
+		throw NotImplementedException(error_message);
+	}
+
 	vector<idx_t> row_id_indexes = {0, 1};
-	auto &delete_op = IcebergDelete::PlanDelete(context, planner, table, child_plan, std::move(row_id_indexes));
+	auto &delete_op =
+	    IcebergDelete::PlanDelete(context, planner, table, child_plan, std::move(row_id_indexes), copy_on_write);
 
 	// build update expressions (physical columns only, no partition cols, no casts)
 	vector<unique_ptr<Expression>> expressions;
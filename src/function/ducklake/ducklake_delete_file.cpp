@@ -16,27 +16,20 @@ DuckLakeDeleteFile::DuckLakeDeleteFile(const IcebergManifestEntry &manifest_entr
 	file_format = StringUtil::Lower(data_file.file_format);
 	if (file_format == "parquet") {
 		//! Find lower and upper bounds for the 'file_path' of the position delete file
-		auto lower_bound_it = data_file.lower_bounds.find(2147483546);
-		auto upper_bound_it = data_file.upper_bounds.find(2147483546);
-		if (lower_bound_it == data_file.lower_bounds.end() || upper_bound_it == data_file.upper_bounds.end()) {
+		auto lower_bound = data_file.column_stats.LowerBound(2147483546);
+		auto upper_bound = data_file.column_stats.UpperBound(2147483546);
+		if (!lower_bound || !upper_bound) {
 			throw InvalidInputException(
 			    "No lower/upper bounds are available for the Position Delete File for table %s, this is "
 			    "required for export to DuckLake",
 			    table_name);
 		}
 
-		auto &lower_bound = lower_bound_it->second;
-		auto &upper_bound = upper_bound_it->second;
-
-		if (lower_bound.IsNull() || upper_bound.IsNull()) {
-			throw InvalidInputException("Lower and Upper bounds for a Position Delete File can not be NULL!");
-		}
-
-		if (lower_bound != upper_bound) {
+		if (lower_bound->GetString() != upper_bound->GetString()) {
 			throw InvalidInputException("For a Position Delete File to be eligible for conversion to DuckLake, it can "
 			                            "only reference a single data file");
 		}
-		data_file_path = lower_bound.GetValue<string>();
+		data_file_path = lower_bound->GetString();
 	} else if (file_format == "puffin") {
 		if (!data_file.content_offset) {
 			throw InvalidConfigurationException("Puffin delete file is missing 'content_offset'");
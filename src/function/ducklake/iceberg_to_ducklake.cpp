@@ -1,6 +1,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
 #include "duckdb/common/enums/join_type.hpp"
+#include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/parser/query_node/select_node.hpp"
 #include "duckdb/parser/tableref/joinref.hpp"
 #include "duckdb/common/enums/joinref_type.hpp"
@@ -84,12 +85,11 @@ static unordered_map<int64_t, DuckLakeColumn> SchemaToColumns(const IcebergTable
 	return result;
 }
 
-static string GetNumericStats(const unordered_map<int32_t, int64_t> &stats, int64_t column_id) {
-	auto it = stats.find(column_id);
-	if (it == stats.end()) {
+static string GetNumericStats(const optional<int64_t> &stat) {
+	if (!stat) {
 		return "NULL";
 	}
-	return to_string(it->second);
+	return to_string(*stat);
 }
 
 struct IcebergToDuckLakeBindData : public TableFunctionData {
@@ -467,21 +467,14 @@ public:
 					auto &manifest_entry = data_file.manifest_entry;
 					auto &iceberg_data_file = manifest_entry.data_file;
 
-					auto column_size_bytes = GetNumericStats(iceberg_data_file.column_sizes, column_id);
-					auto value_count = GetNumericStats(iceberg_data_file.value_counts, column_id);
+					auto &column_stats = iceberg_data_file.column_stats;
+					auto field_id = NumericCast<int32_t>(column_id);
+					auto column_size_bytes = GetNumericStats(column_stats.ColumnSize(field_id));
+					auto value_count = GetNumericStats(column_stats.ValueCount(field_id));
 
-					Value lower_bound;
-					Value upper_bound;
 					Value null_count;
-
-					auto lower_bound_it = iceberg_data_file.lower_bounds.find(column.column_id);
-					auto upper_bound_it = iceberg_data_file.upper_bounds.find(column.column_id);
-					if (lower_bound_it != iceberg_data_file.lower_bounds.end()) {
-						lower_bound = lower_bound_it->second;
-					}
-					if (upper_bound_it != iceberg_data_file.upper_bounds.end()) {
-						upper_bound = upper_bound_it->second;
-					}
+					auto lower_bound = column_stats.GetBoundValue(IcebergColumnStatType::LOWER_BOUND, field_id);
+					auto upper_bound = column_stats.GetBoundValue(IcebergColumnStatType::UPPER_BOUND, field_id);
 
 					LogicalType logical_type;
 					if (!column.IsNested()) {
@@ -493,15 +486,14 @@ public:
 					//! Transform the stats stored in the iceberg metadata
 					auto stats = IcebergPredicateStats::DeserializeBounds(lower_bound, upper_bound, column.column_name,
 					                                                      logical_type);
-					auto null_counts_it = iceberg_data_file.null_value_counts.find(column.column_id);
-					if (null_counts_it != iceberg_data_file.null_value_counts.end()) {
-						null_count = null_counts_it->second;
+					auto file_null_count = column_stats.NullValueCount(field_id);
+					if (file_null_count) {
+						null_count = *file_null_count;
 						stats.has_null = null_count != 0;
 					}
-					auto nan_counts_it = iceberg_data_file.nan_value_counts.find(column.column_id);
-					if (nan_counts_it != iceberg_data_file.nan_value_counts.end()) {
-						auto &nan_count = nan_counts_it->second;
-						stats.has_nan = nan_count != 0;
+					auto nan_count = column_stats.NanValueCount(field_id);
+					if (nan_count) {
+						stats.has_nan = *nan_count != 0;
 					}
 
 					auto contains_nan = stats.has_nan ? "true" : "false";
@@ -835,7 +827,14 @@ static unique_ptr<FunctionData> IcebergToDuckLakeBind(ClientContext &context, Ta
 		auto &tables = schema_entry.tables;
 		tables.ScanTables(context, [&](IcebergTable &table) {
 			tables.FillEntry(context, table);
-			ret->AddTable(table, context, options);
+			if (table.has_all_snapshots) {
+				ret->AddTable(table, context, options);
+				return;
+			}
+			// The entry is shared with other transactions, load the snapshots 'refs' left out into a copy of it
+			auto table_copy = table.Copy();
+			table_copy.LoadAllSnapshots(context);
+			ret->AddTable(table_copy, context, options);
 		});
 	}
 
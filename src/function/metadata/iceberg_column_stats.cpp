@@ -2,6 +2,7 @@
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/storage/statistics/geometry_stats.hpp"
 
@@ -118,6 +119,13 @@ static unique_ptr<FunctionData> IcebergColumnStatsBind(ClientContext &context, T
 	return std::move(ret);
 }
 
+static Value CountToValue(const optional<int64_t> &count) {
+	if (!count) {
+		return Value(LogicalType::BIGINT);
+	}
+	return Value::BIGINT(*count);
+}
+
 static void AddString(Vector &vec, idx_t index, string_t &&str) {
 	FlatVector::GetDataMutable<string_t>(vec)[index] = StringVector::AddString(vec, std::move(str));
 }
@@ -170,36 +178,14 @@ static void IcebergColumnStatsFunction(ClientContext &context, TableFunctionInpu
 
 				auto &column = IcebergTableSchema::GetFromColumnIndex(schema, column_id, 0);
 
-				Value lower_bound;
-				Value upper_bound;
-				Value column_size;
-				Value value_count;
-				Value null_value_count;
-				Value nan_value_count;
-				auto lower_bound_it = data_file.lower_bounds.find(source_id);
-				if (lower_bound_it != data_file.lower_bounds.end()) {
-					lower_bound = lower_bound_it->second;
-				}
-				auto upper_bound_it = data_file.upper_bounds.find(source_id);
-				if (upper_bound_it != data_file.upper_bounds.end()) {
-					upper_bound = upper_bound_it->second;
-				}
-				auto column_size_it = data_file.column_sizes.find(source_id);
-				if (column_size_it != data_file.column_sizes.end()) {
-					column_size = Value::BIGINT(column_size_it->second);
-				}
-				auto value_count_it = data_file.value_counts.find(source_id);
-				if (value_count_it != data_file.value_counts.end()) {
-					value_count = Value::BIGINT(value_count_it->second);
-				}
-				auto null_value_count_it = data_file.null_value_counts.find(source_id);
-				if (null_value_count_it != data_file.null_value_counts.end()) {
-					null_value_count = Value::BIGINT(null_value_count_it->second);
-				}
-				auto nan_value_count_it = data_file.nan_value_counts.find(source_id);
-				if (nan_value_count_it != data_file.nan_value_counts.end()) {
-					nan_value_count = Value::BIGINT(nan_value_count_it->second);
-				}
+				auto &column_stats = data_file.column_stats;
+				auto field_id = NumericCast<int32_t>(source_id);
+				auto lower_bound = column_stats.GetBoundValue(IcebergColumnStatType::LOWER_BOUND, field_id);
+				auto upper_bound = column_stats.GetBoundValue(IcebergColumnStatType::UPPER_BOUND, field_id);
+				auto column_size = CountToValue(column_stats.ColumnSize(field_id));
+				auto value_count = CountToValue(column_stats.ValueCount(field_id));
+				auto null_value_count = CountToValue(column_stats.NullValueCount(field_id));
+				auto nan_value_count = CountToValue(column_stats.NanValueCount(field_id));
 
 				//! column_name
 				AddString(output.data[col++], out, string_t(column.name));
@@ -117,6 +117,8 @@ static void IcebergRollbackToSnapshotFunction(ClientContext &context, TableFunct
 
 	auto &iceberg_transaction = IcebergTransaction::Get(context, iceberg_table->catalog);
 	ApplyTableUpdate(table_info, iceberg_transaction, [&](IcebergTable &tbl) {
+		// the target snapshot and its ancestry may not be referenced by a branch or tag
+		tbl.LoadAllSnapshots(context);
 		auto &transaction_data = tbl.GetOrCreateTransactionData(iceberg_transaction);
 		transaction_data.TableRollbackToSnapshot(bind_data.snapshot_id);
 	});
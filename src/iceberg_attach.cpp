@@ -6,6 +6,7 @@
 #include "catalog/rest/storage/authorization/sigv4.hpp"
 #include "catalog/rest/storage/authorization/none.hpp"
 #include "duckdb/logging/logger.hpp"
+#include "duckdb/main/config.hpp"
 #include "regex"
 
 namespace duckdb {
@@ -258,10 +259,51 @@ unique_ptr<Catalog> IcebergAttach::Attach(optional_ptr<StorageExtensionInfo> sto
 				throw ConversionException("Could not get interval information from %s", interval_option.ToString());
 			}
 			attach_options.max_table_staleness_micros = interval_in_micros;
+		} else if (lower_name == "table_refresh_after") {
+			auto interval_option = entry.second.DefaultCastAs(LogicalType::INTERVAL);
+			auto interval_value = interval_option.GetValue<interval_t>();
+			int64_t interval_in_micros = 0;
+			if (!Interval::TryGetMicro(interval_value, interval_in_micros) || interval_in_micros < 0) {
+				throw ConversionException("Could not get interval information from %s", interval_option.ToString());
+			}
+			attach_options.table_refresh_after_micros = interval_in_micros;
+		} else if (lower_name == "group_commit_window") {
+			auto interval_option = entry.second.DefaultCastAs(LogicalType::INTERVAL);
+			auto interval_value = interval_option.GetValue<interval_t>();
+			int64_t interval_in_micros = 0;
+			if (!Interval::TryGetMicro(interval_value, interval_in_micros) || interval_in_micros < 0) {
+				throw ConversionException("Could not get interval information from %s", interval_option.ToString());
+			}
+			if (interval_in_micros > 0) {
+				attach_options.group_commit_window_micros = interval_in_micros;
+			}
+		} else if (lower_name == "snapshot_loading_mode") {
+			auto mode = StringUtil::Lower(entry.second.ToString());
+			if (mode == "all") {
+				attach_options.snapshot_loading_mode = IcebergSnapshotLoadingMode::ALL;
+			} else if (mode == "refs") {
+				attach_options.snapshot_loading_mode = IcebergSnapshotLoadingMode::REFS;
+			} else {
+				throw InvalidInputException(
+				    "Unrecognized snapshot loading mode '%s'. Supported options are 'all' and 'refs'", mode);
+			}
+		} else if (lower_name == "prefetch_tables") {
+			attach_options.prefetch_tables = entry.second.DefaultCastAs(LogicalType::BOOLEAN).GetValue<bool>();
+		} else if (lower_name == "scan_plan_cache_size") {
+			attach_options.scan_plan_cache_size = DBConfig::ParseMemoryLimit(entry.second.ToString());
 		} else {
 			attach_options.options.emplace(std::move(entry));
 		}
 	}
+	if (attach_options.table_refresh_after_micros.IsValid()) {
+		if (!attach_options.max_table_staleness_micros.IsValid()) {
+			throw InvalidConfigurationException("'table_refresh_after' requires 'max_table_staleness' to be set");
+		}
+		if (attach_options.table_refresh_after_micros.GetIndex() >=
+		    attach_options.max_table_staleness_micros.GetIndex()) {
+			throw InvalidConfigurationException("'table_refresh_after' has to be smaller than 'max_table_staleness'");
+		}
+	}
 	if (used_legacy_endpoint) {
 		DUCKDB_LOG_WARNING(context, "The Iceberg attach option 'endpoint' is deprecated; use 'uri' instead");
 	}
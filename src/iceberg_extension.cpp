@@ -100,6 +100,13 @@ static void LoadInternal(ExtensionLoader &loader) {
 	config.AddExtensionOption("iceberg_test_force_token_expiry",
 	                          "DEBUG SETTING: force OAuth2 token expiry for testing automatic refresh",
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("iceberg_test_fail_group_commit",
+	                          "DEBUG SETTING: fail every group commit, for testing that its members receive the error",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("iceberg_test_group_commit_size",
+	                          "DEBUG SETTING: hold the leader of a group commit until this many transactions are in "
+	                          "the group, regardless of the window (0 disables)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
 	config.AddExtensionOption(
 	    DEFAULT_FORMAT_VERSION_CONFIG_VARIABLE,
 	    "The Iceberg format version used when creating a new table without an explicit 'format-version' property. "
@@ -123,6 +130,15 @@ static void LoadInternal(ExtensionLoader &loader) {
 	    "DANGEROUS TESTING-ONLY SETTING: interpret a null Iceberg STRUCT default as an empty struct whose fields "
 	    "use their own defaults. The only non-null value accepted is '{}'.",
 	    LogicalType::VARCHAR, Value(LogicalType::VARCHAR), SetUnsafeStructNullDefaultInterpretation, SetScope::GLOBAL);
+	config.AddExtensionOption(MANIFEST_CACHE_DIRECTORY_CONFIG_VARIABLE,
+	                          "Directory in which decoded Iceberg manifests and manifest lists are cached across "
+	                          "queries. The cache is disabled when this is empty.",
+	                          LogicalType::VARCHAR, Value(""), nullptr, SetScope::GLOBAL);
+	config.AddExtensionOption(MANIFEST_CACHE_MAX_SIZE_CONFIG_VARIABLE,
+	                          "Maximum size in bytes of the Iceberg manifest cache directory, the least recently used "
+	                          "cached files are evicted first.",
+	                          LogicalType::UBIGINT, Value::UBIGINT(DEFAULT_MANIFEST_CACHE_MAX_SIZE), nullptr,
+	                          SetScope::GLOBAL);
 #ifdef ICEBERG_ENABLE_EQUALITY_DELETE_WRITES
 	config.AddExtensionOption(
 	    ENABLE_EQUALITY_DELETES_CONFIG_VARIABLE,
@@ -158,6 +174,7 @@ static void LoadInternal(ExtensionLoader &loader) {
 
 	auto &log_manager = instance.GetLogManager();
 	log_manager.RegisterLogType(make_uniq<IcebergLogType>());
+	log_manager.RegisterLogType(make_uniq<IcebergManifestMergeLogType>());
 	StorageExtension::Register(config, "iceberg", make_shared_ptr<IRCStorageExtension>());
 	OptimizerExtension::Register(config, IcebergOptimizer::Create());
 }
@@ -1,5 +1,7 @@
 #include "iceberg_logging.hpp"
 
+#include "duckdb/common/types/value.hpp"
+
 namespace duckdb {
 
 constexpr LogLevel IcebergLogType::LEVEL;
@@ -7,4 +9,26 @@ constexpr LogLevel IcebergLogType::LEVEL;
 IcebergLogType::IcebergLogType() : LogType(NAME, LEVEL) {
 }
 
+constexpr LogLevel IcebergManifestMergeLogType::LEVEL;
+
+IcebergManifestMergeLogType::IcebergManifestMergeLogType() : LogType(NAME, LEVEL, GetLogType()) {
+}
+
+LogicalType IcebergManifestMergeLogType::GetLogType() {
+	child_list_t<LogicalType> child_list = {{"table_name", LogicalType::VARCHAR},
+	                                        {"manifests", LogicalType::UBIGINT},
+	                                        {"merged_manifests", LogicalType::UBIGINT},
+	                                        {"duration_ms", LogicalType::BIGINT}};
+	return LogicalType::STRUCT(child_list);
+}
+
+string IcebergManifestMergeLogType::ConstructLogMessage(const string &table_name, idx_t manifests,
+                                                        idx_t merged_manifests, int64_t duration_ms) {
+	child_list_t<Value> child_list = {{"table_name", Value(table_name)},
+	                                  {"manifests", Value::UBIGINT(manifests)},
+	                                  {"merged_manifests", Value::UBIGINT(merged_manifests)},
+	                                  {"duration_ms", Value::BIGINT(duration_ms)}};
+	return Value::STRUCT(std::move(child_list)).ToString();
+}
+
 } // namespace duckdb
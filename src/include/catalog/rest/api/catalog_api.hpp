@@ -38,6 +38,8 @@ public:
 	T result_;
 	HTTPStatusCode status_;
 	optional<rest_api_objects::IcebergErrorResponse> error_;
+	//! The 'ETag' header of the response, empty if the catalog didn't send one
+	string etag_;
 };
 
 class CommitResult {
@@ -63,27 +65,56 @@ public:
 	optional<rest_api_objects::IcebergErrorResponse> error_;
 };
 
+//! Discovers the namespaces below 'parent' breadth-first. Every call to 'Next' returns the next level: the children of
+//! all namespaces returned by the previous call, listed concurrently. Nested levels are only discovered with
+//! 'support_nested_namespaces'.
+class IRCNamespaceCrawler {
+public:
+	IRCNamespaceCrawler(ClientContext &context, IcebergCatalog &catalog, const vector<string> &parent);
+
+public:
+	//! Fills 'result' with the next level of namespaces, returns false once all of them have been discovered
+	bool Next(vector<IRCAPISchema> &result);
+
+private:
+	ClientContext &context;
+	IcebergCatalog &catalog;
+	//! The namespaces whose children are listed by the next call
+	vector<vector<string>> parents;
+};
+
 class IRCAPI {
 public:
 	static const string API_VERSION_1;
+	//! The maximum number of requests that are sent to the catalog at the same time
+	static constexpr idx_t MAX_CONCURRENT_REQUESTS = 16;
 	//! Returns 'nullopt' if the catalog refused the listing, which must not be read as "the schema is empty".
 	static optional<vector<rest_api_objects::TableIdentifier>>
 	GetTables(ClientContext &context, IcebergCatalog &catalog, const IcebergSchemaEntry &schema);
+	//! List the tables of several schemas concurrently, the results are in the order of 'schemas'
+	static vector<optional<vector<rest_api_objects::TableIdentifier>>>
+	GetTables(ClientContext &context, IcebergCatalog &catalog, const vector<reference<IcebergSchemaEntry>> &schemas);
 	static bool VerifyResponse(ClientContext &context, IcebergCatalog &catalog, IRCEndpointBuilder &url_builder,
 	                           bool execute_head);
 	static bool VerifySchemaExistence(ClientContext &context, IcebergCatalog &catalog, const string &schema);
 	static bool VerifyTableExistence(ClientContext &context, IcebergCatalog &catalog, const IcebergSchemaEntry &schema,
 	                                 const string &table);
 	static vector<string> ParseSchemaName(const string &namespace_name);
-	static APIResult<unique_ptr<const rest_api_objects::LoadTableResult>> GetTable(ClientContext &context,
-	                                                                               IcebergCatalog &catalog,
-	                                                                               const IcebergSchemaEntry &schema,
-	                                                                               const string &table_name);
+	//! If 'etag' is set it is sent as 'If-None-Match', a '304 Not Modified' response then leaves 'result_' unset.
+	//! The snapshots are loaded according to the catalog's SNAPSHOT_LOADING_MODE, unless 'all_snapshots' is set.
+	static APIResult<unique_ptr<const rest_api_objects::LoadTableResult>>
+	GetTable(ClientContext &context, IcebergCatalog &catalog, const IcebergSchemaEntry &schema,
+	         const string &table_name, const string &etag = string(), bool all_snapshots = false);
+	//! Same as above, for a table that is identified by the items of its namespace
+	static APIResult<unique_ptr<const rest_api_objects::LoadTableResult>>
+	GetTable(ClientContext &context, IcebergCatalog &catalog, const vector<string> &namespace_items,
+	         const string &table_name, const string &etag = string(), bool all_snapshots = false);
 	static APIResult<unique_ptr<const rest_api_objects::LoadCredentialsResponse>>
 	GetTableCredentials(ClientContext &context, IcebergCatalog &catalog, const IcebergSchemaEntry &schema,
 	                    const string &table_name);
 	static APIResult<unique_ptr<const rest_api_objects::GetNamespaceResponse>>
 	GetNamespace(ClientContext &context, IcebergCatalog &catalog, const IcebergSchemaEntry &schema);
+	//! All namespaces below 'parent' (see IRCNamespaceCrawler)
 	static vector<IRCAPISchema> GetSchemas(ClientContext &context, IcebergCatalog &catalog,
 	                                       const vector<string> &parent);
 	static CommitResult CommitTableUpdate(ClientContext &context, IcebergCatalog &catalog, const vector<string> &schema,
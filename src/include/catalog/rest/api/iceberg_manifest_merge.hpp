@@ -5,6 +5,8 @@
 #include "duckdb/common/types.hpp"
 #include "duckdb/function/copy_function.hpp"
 
+#include <functional>
+
 #include "core/metadata/manifest/iceberg_manifest_list.hpp"
 
 namespace duckdb {
@@ -33,6 +35,13 @@ struct IcebergManifestMerge {
 	static IcebergManifestListEntry ScanManifestEntries(const IcebergManifestListEntry &list_entry,
 	                                                    IcebergCommitState &commit_state, int32_t schema_id);
 
+	//! Read the manifest_entries of a manifest one chunk at a time, handing every decoded batch to 'callback'
+	//! instead of keeping them. The callback returns false to stop reading early. Returns the manifest's metadata,
+	//! parsed from the Avro header.
+	static IcebergManifestMetadata
+	StreamManifestEntries(const IcebergManifestListEntry &list_entry, IcebergCommitState &commit_state,
+	                      int32_t schema_id, const std::function<bool(vector<IcebergManifestEntry> &)> &callback);
+
 	//! Build and persist a replacement manifest from already-materialized entries. The metadata-driven
 	//! manifest creation is shared by merge-append and delete-driven rewrites; callers can override
 	//! file-level lineage/sequence metadata when the physical rewrite must preserve historical values.
@@ -53,8 +62,8 @@ struct IcebergManifestMerge {
 	//! Merge a set of already-committed manifests of a single content type (DATA or DELETE; the two
 	//! are never mixed). Manifests are grouped by (schema id, partition spec id) -- each manifest's
 	//! schema id is resolved by opening the file -- and only manifests sharing both are candidates to
-	//! merge. Bins selected for merge are rewritten into a single new manifest; everything else is
-	//! passed through unchanged.
+	//! merge. Bins selected for merge are streamed into a single new manifest; everything else is
+	//! passed through unchanged, without reading its entries.
 	static vector<IcebergManifestListEntry> MergeManifests(vector<IcebergManifestListEntry> &&input,
 	                                                       IcebergManifestContentType content,
 	                                                       const IcebergManifestMergeConfig &config,
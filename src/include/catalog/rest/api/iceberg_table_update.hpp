@@ -2,6 +2,7 @@
 
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "rest_catalog/objects/list.hpp"
 #include "core/metadata/manifest/iceberg_manifest_list.hpp"
 
@@ -48,6 +49,8 @@ public:
 	int64_t next_row_id = 0;
 
 	ClientContext &context;
+	//! Guards 'created_metadata_files', manifests are rewritten and merged in parallel
+	mutex lock;
 	vector<string> created_metadata_files;
 
 	//! All the 'manifest_file' entries we will write to the new manifest list
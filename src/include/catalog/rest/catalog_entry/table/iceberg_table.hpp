@@ -70,6 +70,10 @@ public:
 	bool HasTransactionUpdates() const;
 	void InitializeFromLoadTableResult(const rest_api_objects::LoadTableResult &load_table_result);
 	void RefreshFromCatalog(ClientContext &context);
+	//! Add the snapshots a SNAPSHOT_LOADING_MODE 'refs' load left out (e.g. for time travel) to 'table_metadata'
+	void LoadAllSnapshots(ClientContext &context);
+	//! Add the snapshots a SNAPSHOT_LOADING_MODE 'refs' load left out to 'metadata', a copy of 'table_metadata'
+	void LoadAllSnapshots(ClientContext &context, IcebergTableMetadata &metadata) const;
 
 public:
 	IcebergCatalog &catalog;
@@ -84,6 +88,8 @@ public:
 	unique_ptr<IcebergTransactionData> transaction_data;
 	//! The cached response this table was initialized from, used as an identity and never dereferenced.
 	optional_ptr<const rest_api_objects::LoadTableResult> initialization_source;
+	//! Whether 'table_metadata' has all snapshots of the table, not only the ones referenced by a branch or tag
+	bool has_all_snapshots = true;
 
 private:
 	//! Unchanged by rename, used to check for a rename
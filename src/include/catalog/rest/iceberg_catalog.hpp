@@ -11,27 +11,37 @@
 
 #include "catalog/rest/api/url_utils.hpp"
 #include "catalog/rest/iceberg_schema_set.hpp"
+#include "catalog/rest/iceberg_table_refresher.hpp"
 #include "rest_catalog/objects/load_table_result.hpp"
 #include "catalog/rest/storage/iceberg_authorization.hpp"
+#include "catalog/rest/transaction/iceberg_group_commit.hpp"
 #include "common/iceberg_utils.hpp"
 
 namespace duckdb {
 
 class IcebergSchemaEntry;
+class IcebergScanPlanCache;
 struct IcebergTable;
 
 class MetadataCacheValue {
 public:
-	MetadataCacheValue(timestamp_ms_t expire_timestamp_ms,
-	                   unique_ptr<const rest_api_objects::LoadTableResult> load_table_result)
-	    : expire_timestamp_ms(expire_timestamp_ms), load_table_result(std::move(load_table_result)) {
+	MetadataCacheValue(timestamp_ms_t expire_timestamp_ms, timestamp_ms_t refresh_timestamp_ms,
+	                   unique_ptr<const rest_api_objects::LoadTableResult> load_table_result, string etag)
+	    : expire_timestamp_ms(expire_timestamp_ms), refresh_timestamp_ms(refresh_timestamp_ms),
+	      load_table_result(std::move(load_table_result)), etag(std::move(etag)) {
 	}
 
 public:
 	//! The timestamp until when this entry is valid
 	timestamp_ms_t expire_timestamp_ms;
+	//! The timestamp after which this entry is refreshed in the background, while it is still served
+	timestamp_ms_t refresh_timestamp_ms;
+	//! Whether a background refresh of this entry is scheduled or running
+	bool refreshing = false;
 	//! The payload of the cache entry
 	unique_ptr<const rest_api_objects::LoadTableResult> load_table_result;
+	//! The ETag the catalog returned with the payload, used to revalidate the entry once it expired
+	string etag;
 };
 
 class LoadTableResultCache {
@@ -59,9 +69,89 @@ public:
 		callback(*entry.load_table_result);
 		return true;
 	}
-	void SetOrOverwrite(const string &table_key,
-	                    unique_ptr<const rest_api_objects::LoadTableResult> load_table_result) {
+	void SetOrOverwrite(const string &table_key, unique_ptr<const rest_api_objects::LoadTableResult> load_table_result,
+	                    const string &etag = string()) {
 		annotated_lock_guard<annotated_mutex> guard(lock);
+		auto expire_timestamp_ms = GetExpireTimestamp();
+		auto refresh_timestamp_ms = GetRefreshTimestamp();
+
+		// erase load table result if it exists.
+		tables.erase(table_key);
+		tables.emplace(table_key, MetadataCacheValue(expire_timestamp_ms, refresh_timestamp_ms,
+		                                             std::move(load_table_result), etag));
+	}
+	//! The ETag of the cached result for 'table_key' (expired or not), empty if there is none
+	string GetETag(const string &table_key) {
+		annotated_lock_guard<annotated_mutex> guard(lock);
+		auto it = tables.find(table_key);
+		if (it == tables.end()) {
+			return string();
+		}
+		return it->second.etag;
+	}
+	//! The catalog confirmed (304 Not Modified) that the result cached with 'etag' is current: extend its validity
+	//! and hand it to 'callback'. Returns false if the entry was replaced or evicted in the meantime.
+	bool Revalidate(const string &table_key, const string &etag,
+	                const std::function<void(const rest_api_objects::LoadTableResult &)> &callback) {
+		annotated_lock_guard<annotated_mutex> guard(lock);
+		auto it = tables.find(table_key);
+		if (it == tables.end() || it->second.etag != etag) {
+			return false;
+		}
+		auto &entry = it->second;
+		entry.expire_timestamp_ms = GetExpireTimestamp();
+		entry.refresh_timestamp_ms = GetRefreshTimestamp();
+		callback(*entry.load_table_result);
+		return true;
+	}
+	//! Claim the background refresh of the result cached for 'table_key' once it is older than TABLE_REFRESH_AFTER.
+	//! Only one caller gets the cached result (and its ETag) back, that caller schedules the refresh.
+	optional_ptr<const rest_api_objects::LoadTableResult> ClaimRefresh(const string &table_key, string &etag) {
+		if (!attach_options.table_refresh_after_micros.IsValid()) {
+			return nullptr;
+		}
+		annotated_lock_guard<annotated_mutex> guard(lock);
+		auto it = tables.find(table_key);
+		if (it == tables.end()) {
+			return nullptr;
+		}
+		auto &entry = it->second;
+		if (entry.refreshing || GetTimestamp(system_clock::now()) < entry.refresh_timestamp_ms) {
+			return nullptr;
+		}
+		entry.refreshing = true;
+		etag = entry.etag;
+		return entry.load_table_result.get();
+	}
+	//! Complete the background refresh claimed for the cached 'source': replace it by 'load_table_result', or only
+	//! extend its validity if that is null (the catalog confirmed 'source' is current). If the refresh failed, the
+	//! entry can be claimed again once TABLE_REFRESH_AFTER passed again. Nothing happens if 'source' was replaced.
+	void FinishRefresh(const string &table_key, optional_ptr<const rest_api_objects::LoadTableResult> source,
+	                   bool success, unique_ptr<const rest_api_objects::LoadTableResult> load_table_result = nullptr,
+	                   const string &etag = string()) {
+		annotated_lock_guard<annotated_mutex> guard(lock);
+		auto it = tables.find(table_key);
+		if (it == tables.end() || it->second.load_table_result.get() != source.get()) {
+			return;
+		}
+		auto &entry = it->second;
+		entry.refreshing = false;
+		entry.refresh_timestamp_ms = GetRefreshTimestamp();
+		if (!success) {
+			return;
+		}
+		entry.expire_timestamp_ms = GetExpireTimestamp();
+		if (load_table_result) {
+			entry.load_table_result = std::move(load_table_result);
+			entry.etag = etag;
+		}
+	}
+
+	//! Evict only if the table was initialized from the result that is still cached for its key.
+	void EvictIfCurrent(const IcebergTable &table);
+
+private:
+	timestamp_ms_t GetExpireTimestamp() const {
 		// If max_table_staleness_minutes is not set, use a time in the past so cache is always expired
 		system_clock::time_point expires_at;
 		if (attach_options.max_table_staleness_micros.IsValid()) {
@@ -70,16 +160,23 @@ public:
 		} else {
 			expires_at = system_clock::time_point::min();
 		}
-		auto epoch_micros = timestamp_t(duration_cast<microseconds>(expires_at.time_since_epoch()).count());
-		auto expire_timestamp_ms = timestamp_ms_t(Timestamp::GetEpochMs(epoch_micros));
-
-		// erase load table result if it exists.
-		tables.erase(table_key);
-		tables.emplace(table_key, MetadataCacheValue(expire_timestamp_ms, std::move(load_table_result)));
+		return GetTimestamp(expires_at);
+	}
+	timestamp_ms_t GetRefreshTimestamp() const {
+		// If table_refresh_after is not set, entries are never refreshed in the background
+		system_clock::time_point refresh_at;
+		if (attach_options.table_refresh_after_micros.IsValid()) {
+			refresh_at =
+			    system_clock::now() + std::chrono::microseconds(attach_options.table_refresh_after_micros.GetIndex());
+		} else {
+			refresh_at = system_clock::time_point::max();
+		}
+		return GetTimestamp(refresh_at);
+	}
+	static timestamp_ms_t GetTimestamp(system_clock::time_point time_point) {
+		auto epoch_micros = timestamp_t(duration_cast<microseconds>(time_point.time_since_epoch()).count());
+		return timestamp_ms_t(Timestamp::GetEpochMs(epoch_micros));
 	}
-
-	//! Evict only if the table was initialized from the result that is still cached for its key.
-	void EvictIfCurrent(const IcebergTable &table);
 
 private:
 	IcebergAttachOptions &attach_options;
@@ -164,8 +261,8 @@ public:
 	//! Allow ATTACH OR REPLACE to actually re-attach when iceberg-specific options change
 	bool HasConflictingAttachOptions(const string &path, const AttachOptions &options) override;
 	void SetAttachOptions(const unordered_map<string, Value> &options);
-	static string GetOnlyMergeOnReadSupportedErrorMessage(const string &table_name, const string &property,
-	                                                      const string &property_value);
+	static string GetUnsupportedWriteModeErrorMessage(const string &table_name, const string &property,
+	                                                  const string &property_value);
 
 public:
 	AccessMode access_mode;
@@ -194,6 +291,12 @@ public:
 	unordered_set<string> supported_urls;
 	IcebergSchemaSet schemas;
 	LoadTableResultCache table_request_cache;
+	//! Plans of recently scanned snapshots, shared with the scans so it can outlive the catalog
+	shared_ptr<IcebergScanPlanCache> scan_plan_cache;
+	//! Combines concurrent appends to the same table into one commit
+	IcebergGroupCommitCoordinator group_commit;
+	//! Refreshes cached table metadata in the background, declared last as its thread uses the members above
+	IcebergTableRefresher table_refresher;
 };
 
 } // namespace duckdb
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+
+namespace duckdb {
+
+class ClientContext;
+class IcebergCatalog;
+class IcebergTransaction;
+
+//! Loads the metadata of all tables of the catalog that a query references concurrently, before the binder resolves
+//! them. Without it, every table reference costs one LoadTable round trip to the catalog, one after another.
+//! The query text is parsed on the first table lookup of the query, the referenced tables that aren't known to the
+//! transaction yet are loaded in parallel and handed to the transaction, where IcebergTableSet::GetEntry picks them up.
+//! The parsed query text of a connection. A script runs its statements as separate queries with the same query text,
+//! which is parsed once instead of once per statement.
+struct IcebergTablePrefetchState : public ClientContextState {
+public:
+	//! The query text the statements were parsed from
+	string query;
+	//! The parsed statements, empty if the query text could not be parsed
+	vector<unique_ptr<SQLStatement>> statements;
+	//! The (schema name, table name) references of the statements, by catalog name
+	case_insensitive_map_t<vector<pair<string, string>>> tables;
+};
+
+class IcebergTablePrefetch {
+public:
+	static void PrefetchQueryTables(ClientContext &context, IcebergCatalog &catalog, IcebergTransaction &transaction);
+};
+
+} // namespace duckdb
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "rest_catalog/objects/load_table_result.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace duckdb {
+
+class ClientContext;
+class DatabaseInstance;
+class IcebergCatalog;
+
+//! Refreshes cached table metadata in the background once it is older than TABLE_REFRESH_AFTER, the cached metadata
+//! keeps being served in the meantime (stale-while-revalidate). Only metadata older than MAX_TABLE_STALENESS is
+//! reloaded by the query that needs it. The refreshes run one after another on a thread of the catalog, each on a
+//! connection of its own, so they don't depend on the lifetime of the query that scheduled them.
+class IcebergTableRefresher {
+public:
+	explicit IcebergTableRefresher(IcebergCatalog &catalog);
+	~IcebergTableRefresher();
+
+public:
+	//! Refresh the cached 'source' of the table, claimed with LoadTableResultCache::ClaimRefresh
+	void Schedule(ClientContext &context, const string &table_key, const vector<string> &namespace_items,
+	              const string &table_name, optional_ptr<const rest_api_objects::LoadTableResult> source,
+	              const string &etag);
+
+private:
+	struct RefreshRequest {
+		string table_key;
+		vector<string> namespace_items;
+		string table_name;
+		//! The cached result that is refreshed, only used to recognize it in the cache
+		optional_ptr<const rest_api_objects::LoadTableResult> source;
+		string etag;
+	};
+	//! Shared with the refresh thread, which outlives the refresher if releasing the database destroys the catalog
+	struct RefreshQueue {
+		mutex lock;
+		std::condition_variable requests_cv;
+		std::deque<RefreshRequest> requests;
+		bool shutdown = false;
+	};
+
+private:
+	static void Run(IcebergCatalog &catalog, weak_ptr<DatabaseInstance> db, shared_ptr<RefreshQueue> queue);
+	static void Refresh(IcebergCatalog &catalog, DatabaseInstance &db, const RefreshRequest &request);
+
+private:
+	IcebergCatalog &catalog;
+	shared_ptr<RefreshQueue> queue;
+	//! Started by the first refresh
+	std::thread refresh_thread;
+};
+
+} // namespace duckdb
@@ -2,6 +2,7 @@
 
 #include "duckdb/main/secret/secret.hpp"
 #include "duckdb/common/http_util.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/main/client_context_state.hpp"
 
 #include "iceberg_attach.hpp"
@@ -14,16 +15,22 @@ class IcebergHTTPClientLock {
 public:
 	IcebergHTTPClientLock(mutex &client_lock, unordered_map<uintptr_t, unique_ptr<HTTPClient>> &client_map,
 	                      uintptr_t database_id)
-	    : guard(client_lock), client(client_map.emplace(database_id, nullptr).first->second) {
+	    : guard(client_lock, std::try_to_lock) {
+		if (guard.owns_lock()) {
+			client = &client_map.emplace(database_id, nullptr).first->second;
+		}
 	}
 
+	//! The cached client of the connection, or a fresh one if another request of the connection is using it (e.g.
+	//! concurrent table prefetches), so concurrent requests don't wait on each other
 	unique_ptr<HTTPClient> &GetClient() {
-		return client;
+		return client ? *client : placeholder_client;
 	}
 
 private:
 	unique_lock<mutex> guard;
-	unique_ptr<HTTPClient> &client;
+	optional_ptr<unique_ptr<HTTPClient>> client;
+	unique_ptr<HTTPClient> placeholder_client;
 };
 
 //! Hold the pre-initialized HTTPClient for a given connection
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+
+#include <condition_variable>
+#include <functional>
+
+namespace duckdb {
+
+class ClientContext;
+struct IcebergTable;
+
+//! Combines the append-only commits to the same table that arrive within a short window into a single commit.
+//! The first commit to arrive leads the group: it waits for the window to pass, takes over the data files appended by
+//! the commits that joined it and commits all of them in one snapshot. The members wait for the leader and share the
+//! outcome of its commit, so concurrent appenders in one process no longer conflict with each other.
+//! The window ends early once every transaction that staged changes to the table has either joined the group or ended.
+class IcebergGroupCommitCoordinator {
+public:
+	explicit IcebergGroupCommitCoordinator(optional_idx window_micros);
+
+public:
+	bool Enabled() const {
+		return window_micros.IsValid();
+	}
+	//! Commit the appends staged for 'table', together with those of the other transactions in its group.
+	//! 'commit' performs the REST commit of the table, it is only called by the leader of the group.
+	void Commit(ClientContext &context, IcebergTable &table, const std::function<void()> &commit);
+	//! A transaction staged changes to the table, the leader of a group waits for it until the window passes
+	void AddPendingCommit(const string &table_key);
+	//! The transaction that staged changes to the table ended without committing them through Commit
+	void RemovePendingCommit(const string &table_key);
+
+private:
+	struct CommitGroup {
+		explicit CommitGroup(IcebergTable &leader) : leader(leader) {
+		}
+
+		reference<IcebergTable> leader;
+		vector<reference<IcebergTable>> members;
+		bool finished = false;
+		ErrorData error;
+		std::condition_variable finished_cv;
+		//! Notified when a member joins or a pending commit of the table goes away
+		std::condition_variable joined_cv;
+	};
+
+private:
+	//! Requires the lock to be held
+	void RemovePendingCommitInternal(const string &table_key);
+
+private:
+	const optional_idx window_micros;
+	mutex lock;
+	//! The groups that still accept members, by table key
+	case_insensitive_map_t<shared_ptr<CommitGroup>> open_groups;
+	//! The number of transactions with staged changes that have not reached Commit yet, by table key
+	case_insensitive_map_t<idx_t> pending_commits;
+};
+
+} // namespace duckdb
@@ -104,6 +104,8 @@ private:
 	const IcebergTransactionAlterUpdate *GetAlterUpdate() const;
 	bool CanUseMultiTableCommit(const IcebergTransactionAlterUpdate &alter_update) const;
 	void VerifyAlterUpdateAtomicity(const IcebergTransactionAlterUpdate &alter_update) const;
+	//! The table to commit through the catalog's group commit, if the update only appends to a single table
+	optional_ptr<IcebergTable> GetGroupCommitTable(IcebergTransactionAlterUpdate &alter_update);
 	void CleanupMetadataFiles(ClientContext &context, const vector<string> &paths);
 	void RefreshRetryTables(IcebergTransactionAlterUpdate &alter_update, const case_insensitive_set_t &table_keys,
 	                        ClientContext &context);
@@ -137,8 +139,17 @@ public:
 	bool called_list_schemas = false;
 	//! Set of schemas that this transaction has listed tables for
 	case_insensitive_set_t listed_schemas;
+	//! Table listings fetched together with the listing of another schema, by schema name
+	case_insensitive_map_t<optional<vector<rest_api_objects::TableIdentifier>>> prefetched_listings;
 
 	case_insensitive_set_t looked_up_entries;
+	//! Tables of the current query loaded ahead of their lookup by IcebergTablePrefetch, by table key. A null entry
+	//! is a table the catalog doesn't have.
+	case_insensitive_map_t<shared_ptr<IcebergTable>> prefetched_tables;
+	//! The query the tables were prefetched for
+	optional_idx prefetched_query;
+	//! The tables this transaction staged changes to that the catalog's group commit still counts as pending
+	case_insensitive_set_t pending_group_commits;
 	mutex lock;
 
 	case_insensitive_map_t<SchemaPropertyUpdates> schema_property_updates;
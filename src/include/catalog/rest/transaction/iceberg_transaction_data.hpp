@@ -30,13 +30,23 @@ public:
 	bool RetryStateMatches(const IcebergTable &table_info) const;
 	//! Whether this transaction stages a DELETE snapshot; gates the commit-retry safety check.
 	bool ContainsDelete() const;
-	bool IsFileInvalidated(const string &file_path) const;
+	bool IsFileInvalidated(const IcebergDataFile &data_file) const;
+	//! Whether every staged update is an APPEND snapshot, with nothing else the commit has to assert or change
+	bool OnlyAppends() const;
+	//! Whether the appends of 'other' can be committed as part of the appends of this transaction (group commit)
+	bool CanCombineAppends(const IcebergTransactionData &other) const;
+	//! Add the data files appended by 'other' to the last APPEND snapshot of this transaction
+	void CombineAppends(const IcebergTransactionData &other);
 
 	void AddSnapshot(IcebergSnapshotOperationType operation, vector<IcebergManifestEntry> &&data_files,
 	                 IcebergManifestDeletes &&altered_manifests);
 	void AddDeleteSnapshot(partitioned_manifest_entry_map_t &&delete_files, IcebergManifestDeletes &&altered_manifests);
 	void AddUpdateSnapshot(partitioned_manifest_entry_map_t &&delete_files, vector<IcebergManifestEntry> &&data_files,
-	                       IcebergManifestDeletes &&altered_manifests);
+	                       IcebergManifestDeletes &&altered_manifests,
+	                       partitioned_manifest_entry_map_t &&rewritten_files = partitioned_manifest_entry_map_t());
+	//! Copy-on-write DELETE: replaces the data files invalidated in 'altered_manifests' by their rewritten copies
+	void AddOverwriteSnapshot(partitioned_manifest_entry_map_t &&rewritten_files,
+	                          IcebergManifestDeletes &&altered_manifests);
 	// add a schema update for a table
 	void TableAddSchema(int32_t schema_id);
 	void TableSetCurrentSchema(int32_t schema_id);
@@ -60,9 +70,9 @@ public:
 
 private:
 	void CacheExistingManifestList(lock_guard<mutex> &guard, const IcebergTableMetadata &metadata);
-	//! Writes one delete manifest per partition spec present in 'delete_files'.
-	void AddDeleteManifestFiles(IcebergAddSnapshot &add_snapshot, partitioned_manifest_entry_map_t &&delete_files,
-	                            sequence_number_t sequence_number);
+	//! Writes one manifest of 'content' type per partition spec present in 'entries'.
+	void AddPartitionedManifestFiles(IcebergAddSnapshot &add_snapshot, IcebergManifestContentType content,
+	                                 partitioned_manifest_entry_map_t &&entries, sequence_number_t sequence_number);
 	void AddSnapshotUpdate(unique_ptr<IcebergAddSnapshot> add_snapshot, IcebergManifestDeletes &&altered_manifests);
 
 public:
@@ -3,18 +3,44 @@
 #include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "core/metadata/manifest/iceberg_manifest.hpp"
+
+#include <functional>
 
 namespace duckdb {
 
 struct VersionedIcebergManifestDeletes;
+struct IcebergManifestFile;
 
 struct IcebergManifestDeletes {
 public:
-	void InvalidateFile(const string &file_path) {
-		data_files.emplace(file_path, optional_idx());
+	struct InvalidatedFile {
+		bool IsVersion(idx_t version) const {
+			return alter_version.IsValid() && alter_version.GetIndex() == version;
+		}
+
+		//! The alter that invalidated the file, set once the deletes are merged into the transaction
+		optional_idx alter_version;
+		//! Delete files (and deletion vectors) only appear in delete manifests, data files in data manifests
+		bool is_delete_file = false;
+		//! The manifest the file was read from, empty if it isn't known
+		string manifest_path;
+		//! The partition spec and values of the file, if known
+		optional<IcebergPartition> partition;
+	};
+
+public:
+	//! Invalidate a data file of the given partition, read from a manifest that isn't known
+	void InvalidateFile(const string &file_path, IcebergPartition partition) {
+		InvalidatedFile file;
+		file.partition = std::move(partition);
+		data_files.emplace(file_path, std::move(file));
 	}
-	bool IsInvalidated(const string &file_path) const {
-		return data_files.count(file_path);
+	//! Invalidate the file of a manifest entry read from 'manifest'. A deletion vector is only invalidated at its own
+	//! offset: a Puffin file can hold the deletion vectors of many data files
+	void InvalidateEntry(const IcebergDataFile &data_file, const IcebergManifestFile &manifest);
+	bool IsInvalidated(const IcebergDataFile &data_file) const {
+		return data_files.count(GetKey(data_file));
 	}
 	VersionedIcebergManifestDeletes AtVersion(idx_t alter_version);
 	bool IsEmpty() const {
@@ -25,20 +51,24 @@ private:
 	idx_t Merge(IcebergManifestDeletes &&other, idx_t alter_version) {
 		idx_t added_count = 0;
 		for (auto &entry : other.data_files) {
-			added_count += data_files.emplace(entry.first, alter_version).second;
+			InvalidatedFile file = entry.second;
+			file.alter_version = alter_version;
+			added_count += data_files.emplace(entry.first, file).second;
 		}
 		return added_count;
 	}
 	bool IsInvalidatedAt(const string &file_path, idx_t alter_version) const {
 		auto entry = data_files.find(file_path);
-		return entry != data_files.end() && entry->second.IsValid() && entry->second.GetIndex() == alter_version;
+		return entry != data_files.end() && entry->second.IsVersion(alter_version);
 	}
 
+	static string GetKey(const IcebergDataFile &data_file);
+
 private:
 	friend struct VersionedIcebergManifestDeletes;
 
-	//! The 'data_file.file_path' of invalidated files, optionally tagged with the alter that invalidated them
-	unordered_map<string, optional_idx> data_files;
+	//! The 'data_file.file_path' of invalidated files (and the offset of invalidated deletion vectors)
+	unordered_map<string, InvalidatedFile> data_files;
 };
 
 struct VersionedIcebergManifestDeletes {
@@ -50,8 +80,17 @@ public:
 	idx_t Merge(IcebergManifestDeletes &&other) {
 		return manifest_deletes.Merge(std::move(other), alter_version);
 	}
-	bool IsInvalidated(const string &file_path) const {
-		return manifest_deletes.IsInvalidatedAt(file_path, alter_version);
+	bool IsInvalidated(const IcebergDataFile &data_file) const {
+		return manifest_deletes.IsInvalidatedAt(IcebergManifestDeletes::GetKey(data_file), alter_version);
+	}
+	//! Call 'callback' for every file this alter invalidated
+	void
+	ForEachInvalidated(const std::function<void(const IcebergManifestDeletes::InvalidatedFile &)> &callback) const {
+		for (auto &entry : manifest_deletes.data_files) {
+			if (entry.second.IsVersion(alter_version)) {
+				callback(entry.second);
+			}
+		}
 	}
 
 private:
@@ -10,12 +10,15 @@
 
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/catalog/catalog_entry/copy_function_catalog_entry.hpp"
 #include "duckdb/storage/external_file_cache/caching_file_system.hpp"
 
 #include "catalog/rest/catalog_entry/table/iceberg_table_schema_version.hpp"
 #include "core/metadata/iceberg_table_metadata.hpp"
 
+#include <functional>
+
 namespace duckdb {
 
 struct IcebergResolvedMetadata {
@@ -47,6 +50,10 @@ public:
 	static idx_t ParseByteSizeOptionallyFormatted(const string &input);
 	static int64_t AddFileSizeChecked(int64_t total, int64_t file_size_in_bytes);
 	static timestamp_ms_t GetTransactionStartTimeMS(ClientContext &context);
+	//! Call 'function' for every index in [0, count) on the task scheduler, the calling thread helps out. At most
+	//! 'max_tasks' indexes are processed at a time, if set.
+	static void RunIndexedTasks(ClientContext &context, idx_t count, const std::function<void(idx_t)> &function,
+	                            optional_idx max_tasks = optional_idx());
 };
 
 } // namespace duckdb
@@ -18,7 +18,8 @@ public:
 
 public:
 	virtual unique_ptr<DeleteFilter> ToFilter() const = 0;
-	virtual void ToSet(set<idx_t> &out) const = 0;
+	//! Append the deleted positions to 'out', in no particular order
+	virtual void AppendPositions(vector<idx_t> &out) const = 0;
 
 public:
 	IcebergDeleteType type;
@@ -6,6 +6,18 @@
 
 namespace duckdb {
 
+//! 64-bit row positions, keyed on the high 32 bits, holding the low 32 bits in a roaring bitmap
+using deletion_bitmap_map_t = unordered_map<int32_t, roaring::Roaring>;
+
+//! A `deletion-vector-v1` blob (from ToBlob) to be written into a Puffin file
+struct IcebergDeletionVectorBlob {
+	vector<data_t> data;
+	string referenced_data_file;
+	idx_t cardinality = 0;
+	//! Set by ToPuffinFile, the position of the blob in the file (the manifest entry's content_offset)
+	idx_t offset = 0;
+};
+
 struct IcebergDeletionVectorData : public enable_shared_from_this<IcebergDeletionVectorData>, IcebergDeleteData {
 public:
 	IcebergDeletionVectorData(const BoundIcebergManifestEntry &entry)
@@ -17,41 +29,35 @@ public:
 public:
 	static shared_ptr<IcebergDeletionVectorData> FromBlob(const BoundIcebergManifestEntry &entry, data_ptr_t blob_start,
 	                                                      idx_t blob_length);
-	static vector<data_t> ToBlob(const unordered_map<int32_t, roaring::Roaring> &bitmaps);
-	//! Wrap a `deletion-vector-v1` blob (from ToBlob) in a spec-compliant Puffin file
-	//! container: leading magic + blob + footer. The blob is placed at offset 4 (right
-	//! after the leading magic), so the manifest entry's content_offset must be set to 4.
-	static vector<data_t> ToPuffinFile(const vector<data_t> &blob, const string &referenced_data_file,
-	                                   idx_t cardinality);
+	static vector<data_t> ToBlob(const deletion_bitmap_map_t &bitmaps);
+	//! Add every position in 'bitmaps' to 'out'
+	static void AppendBitmapPositions(const deletion_bitmap_map_t &bitmaps, vector<idx_t> &out);
+	//! Pack the blobs into a spec-compliant Puffin file container: leading magic + blobs + one footer describing all
+	//! of them. The offset of every blob is set, the first blob is placed right after the leading magic (offset 4).
+	static vector<data_t> ToPuffinFile(vector<IcebergDeletionVectorBlob> &blobs);
 
 public:
 	unique_ptr<DeleteFilter> ToFilter() const override;
-	void ToSet(set<idx_t> &out) const override;
+	void AppendPositions(vector<idx_t> &out) const override;
 
 public:
-	unordered_map<int32_t, roaring::Roaring> bitmaps;
+	deletion_bitmap_map_t bitmaps;
 };
 
+//! Filter shared by deletion vectors and positional delete files, both store their positions as 'bitmaps'
 struct IcebergDeletionVector : public DeleteFilter {
 public:
-	IcebergDeletionVector(shared_ptr<const IcebergDeletionVectorData> data) : data(data) {
+	IcebergDeletionVector(shared_ptr<const IcebergDeleteData> owner, const deletion_bitmap_map_t &bitmaps)
+	    : owner(std::move(owner)), bitmaps(bitmaps) {
 	}
 
 public:
 	idx_t Filter(row_t start_row_index, idx_t count, SelectionVector &result_sel) override;
 
 public:
-	//! Immutable state of the deletion vector
-	shared_ptr<const IcebergDeletionVectorData> data;
-
-	//! Lock to protect the mutable cache state,
-	//! since this instance can be shared by multiple threads
-	mutex lock;
-	//! State shared between Filter calls
-	roaring::BulkContext bulk_context;
-	optional_ptr<const roaring::Roaring> current_bitmap = nullptr;
-	//! High bits of the current bitmap (the key in the map)
-	optional<int32_t> current_high;
+	//! Keeps the (immutable) bitmaps alive
+	shared_ptr<const IcebergDeleteData> owner;
+	const deletion_bitmap_map_t &bitmaps;
 };
 
 } // namespace duckdb
@@ -1,21 +1,55 @@
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 
+class ClientContext;
+
 struct IcebergEqualityDeleteFile {
 public:
-	explicit IcebergEqualityDeleteFile(vector<int32_t> equality_ids_p) : equality_ids(std::move(equality_ids_p)) {
+	IcebergEqualityDeleteFile(vector<int32_t> equality_ids_p, int64_t sequence_number_p)
+	    : equality_ids(std::move(equality_ids_p)), sequence_number(sequence_number_p) {
 	}
 	IcebergEqualityDeleteFile(const IcebergEqualityDeleteFile &) = delete;
 	IcebergEqualityDeleteFile &operator=(const IcebergEqualityDeleteFile &) = delete;
 
+public:
+	//! Build the hash index over 'equality_values', must be called once all rows have been appended
+	void Finalize();
+	//! Copy of this delete file with its values cast to 'types' (used when a column type was promoted), the copy is
+	//! cached so the data files that share the promoted types share its values and hash index
+	shared_ptr<const IcebergEqualityDeleteFile> CastTo(ClientContext &context, const vector<LogicalType> &types) const;
+	//! Write the rows of 'sel' that do not match any deleted row into 'result', returns the amount of rows written
+	//! The columns of 'keys' follow the 'equality_ids' order, rows match when every column IS NOT DISTINCT FROM
+	idx_t Filter(DataChunk &keys, const SelectionVector &sel, idx_t count, SelectionVector &result) const;
+
+private:
+	//! Clear 'matches[i]' for the (key_rows[i], delete_rows[i]) pairs that differ in column 'column_idx'
+	void MatchColumn(DataChunk &keys, const UnifiedVectorFormat &key_format, idx_t column_idx, const idx_t *key_rows,
+	                 const idx_t *delete_rows, idx_t count, bool *matches) const;
+
 public:
 	//! Columns in equality_values follow this field-id order.
 	vector<int32_t> equality_ids;
+	//! The data sequence number of the delete file, it only applies to data files with a lower sequence number
+	int64_t sequence_number;
 	DataChunk equality_values;
+
+private:
+	//! Row hash -> first row in 'equality_values' with that hash, rows sharing a hash are chained through 'next_row'
+	unordered_map<hash_t, idx_t> first_row;
+	vector<idx_t> next_row;
+	//! The unified format of every column of 'equality_values'
+	unsafe_unique_array<UnifiedVectorFormat> value_formats;
+
+	mutable mutex cast_lock;
+	//! The copies of this delete file cast to other types, see CastTo
+	mutable vector<shared_ptr<const IcebergEqualityDeleteFile>> casts;
 };
 
 } // namespace duckdb
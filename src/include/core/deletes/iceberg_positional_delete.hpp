@@ -2,6 +2,7 @@
 
 #include "duckdb/common/multi_file/multi_file_data.hpp"
 #include "core/deletes/iceberg_delete_data.hpp"
+#include "core/deletes/iceberg_deletion_vector.hpp"
 
 namespace duckdb {
 
@@ -14,41 +15,16 @@ public:
 	}
 
 public:
-	void AddRow(int64_t row_id) {
-		invalid_rows.insert(row_id);
-	}
+	//! Add (at most STANDARD_VECTOR_SIZE) row positions
+	void AddRows(const int64_t *row_ids, idx_t count);
+	//! Add all positions of another positional delete for the same data file
+	void Merge(const IcebergPositionalDeleteData &other);
 	unique_ptr<DeleteFilter> ToFilter() const override;
-	void ToSet(set<idx_t> &out) const override;
-
-public:
-	//! Store invalid rows here before finalizing into a SelectionVector
-	unordered_set<int64_t> invalid_rows;
-};
-
-struct IcebergPositionalDeleteFilter : public DeleteFilter {
-public:
-	IcebergPositionalDeleteFilter(shared_ptr<const IcebergPositionalDeleteData> data) : data(data) {
-	}
-
-public:
-	idx_t Filter(row_t start_row_index, idx_t count, SelectionVector &result_sel) override {
-		if (count == 0) {
-			return 0;
-		}
-		result_sel.Initialize(STANDARD_VECTOR_SIZE);
-		idx_t selection_idx = 0;
-		auto &invalid_rows = data->invalid_rows;
-		for (idx_t i = 0; i < count; i++) {
-			if (!invalid_rows.count(i + start_row_index)) {
-				result_sel.set_index(selection_idx++, i);
-			}
-		}
-		return selection_idx;
-	}
+	void AppendPositions(vector<idx_t> &out) const override;
 
 public:
-	//! Immutable state of the positional delete
-	shared_ptr<const IcebergPositionalDeleteData> data;
+	//! The invalid rows, stored the same way as the positions of a deletion vector
+	deletion_bitmap_map_t bitmaps;
 };
 
 } // namespace duckdb
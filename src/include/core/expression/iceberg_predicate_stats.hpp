@@ -17,6 +17,10 @@ public:
 public:
 	static IcebergPredicateStats DeserializeBounds(const Value &lower_bound, const Value &upper_bound,
 	                                               const string &name, const LogicalType &type);
+	//! Deserialize the bound blobs as stored in the manifest, an absent bound is left unset
+	static IcebergPredicateStats DeserializeBounds(const optional<string_t> &lower_bound,
+	                                               const optional<string_t> &upper_bound, const string &name,
+	                                               const LogicalType &type);
 	void SetLowerBound(const Value &new_lower_bound);
 	void SetUpperBound(const Value &new_upper_bound);
 	bool BoundsAreNull() const;
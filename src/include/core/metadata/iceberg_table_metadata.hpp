@@ -19,6 +19,7 @@ namespace duckdb {
 const string WRITE_UPDATE_MODE = "write.update.mode";
 const string WRITE_DELETE_MODE = "write.delete.mode";
 const string WRITE_DELETE_ISOLATION_LEVEL = "write.delete.isolation-level";
+const string WRITE_DELETE_TARGET_FILE_SIZE = "write.delete.target-file-size-bytes";
 
 struct IcebergMetadataLogItem {
 public:
@@ -90,6 +91,8 @@ public:
 	const case_insensitive_map_t<string> &GetTableProperties() const;
 	string GetTableProperty(string property_string) const;
 	bool PropertiesAllowPositionalDeletes(IcebergSnapshotOperationType operation_type) const;
+	//! Whether the DELETE (or OVERWRITE, for updates) rewrites the affected data files instead of writing deletes
+	bool PropertiesRequireCopyOnWrite(IcebergSnapshotOperationType operation_type) const;
 	string ToJSON() const;
 	void WriteMetadata(ClientContext &context, const string &path) const;
 	void WriteVersionHint(ClientContext &context, const string &path, const string &metadata_json_path) const;
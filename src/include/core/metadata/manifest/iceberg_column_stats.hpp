@@ -0,0 +1,141 @@
+#pragma once
+
+#include "duckdb/common/optional.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/types/string_heap.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! The per-field statistics a manifest entry can carry for a data file
+enum class IcebergColumnStatType : uint8_t {
+	COLUMN_SIZE = 0,
+	VALUE_COUNT = 1,
+	NULL_VALUE_COUNT = 2,
+	NAN_VALUE_COUNT = 3,
+	LOWER_BOUND = 4,
+	UPPER_BOUND = 5
+};
+
+//! The per-field statistics of a batch of data files, stored column-wise.
+//! Every data file owns a contiguous range of rows (sorted by field id), the bounds are stored in an arena that is
+//! shared by the whole batch. A batch is immutable once it is shared between data files.
+struct IcebergColumnStatsBatch {
+public:
+	IcebergColumnStatsBatch();
+
+public:
+	idx_t Size() const {
+		return field_ids.size();
+	}
+	void Reserve(idx_t row_count);
+	//! Append a row for 'field_id' without any statistics, returns its index
+	idx_t AppendRow(int32_t field_id);
+	//! Insert a row for 'field_id' without any statistics at 'row_idx', returns 'row_idx'
+	idx_t InsertRow(idx_t row_idx, int32_t field_id);
+	//! Append a copy of row 'row_idx' of 'source'
+	void AppendRow(const IcebergColumnStatsBatch &source, idx_t row_idx);
+
+	bool HasStat(idx_t row_idx, IcebergColumnStatType type) const {
+		return flags[row_idx] & StatFlag(type);
+	}
+	int64_t GetCount(idx_t row_idx, IcebergColumnStatType type) const;
+	const string_t &GetBound(idx_t row_idx, IcebergColumnStatType type) const;
+	void SetCount(idx_t row_idx, IcebergColumnStatType type, int64_t value);
+	void SetBound(idx_t row_idx, IcebergColumnStatType type, const char *data, idx_t size);
+
+private:
+	static uint8_t StatFlag(IcebergColumnStatType type) {
+		return static_cast<uint8_t>(1 << static_cast<uint8_t>(type));
+	}
+	vector<int64_t> &GetCounts(IcebergColumnStatType type);
+	const vector<int64_t> &GetCounts(IcebergColumnStatType type) const;
+
+public:
+	vector<int32_t> field_ids;
+	//! Bitmask of the statistics that are present for every row
+	vector<uint8_t> flags;
+	vector<int64_t> column_sizes;
+	vector<int64_t> value_counts;
+	vector<int64_t> null_value_counts;
+	vector<int64_t> nan_value_counts;
+	vector<string_t> lower_bounds;
+	vector<string_t> upper_bounds;
+	//! Owns the data of 'lower_bounds' and 'upper_bounds'
+	StringHeap heap;
+};
+
+//! The per-field statistics of a single data file: a range of rows in an IcebergColumnStatsBatch.
+//! Copies share the batch, modifying the statistics first copies the range into a batch of its own.
+class IcebergColumnStats {
+public:
+	IcebergColumnStats();
+	IcebergColumnStats(shared_ptr<IcebergColumnStatsBatch> batch, idx_t offset, idx_t count);
+
+public:
+	//! Whether any field has a statistic of this type
+	bool HasAny(IcebergColumnStatType type) const;
+	//! The number of fields that have a statistic of this type
+	idx_t CountFields(IcebergColumnStatType type) const;
+
+	optional<int64_t> GetCount(IcebergColumnStatType type, int32_t field_id) const;
+	optional<string_t> GetBound(IcebergColumnStatType type, int32_t field_id) const;
+	//! The bound as a BLOB Value, or a NULL Value when the field has no bound of this type
+	Value GetBoundValue(IcebergColumnStatType type, int32_t field_id) const;
+
+	void SetCount(IcebergColumnStatType type, int32_t field_id, int64_t value);
+	void SetBound(IcebergColumnStatType type, int32_t field_id, const string_t &blob);
+	//! Setting a NULL Value is a no-op, an absent bound and a NULL bound are treated alike
+	void SetBound(IcebergColumnStatType type, int32_t field_id, const Value &blob);
+
+	optional<int64_t> ColumnSize(int32_t field_id) const {
+		return GetCount(IcebergColumnStatType::COLUMN_SIZE, field_id);
+	}
+	optional<int64_t> ValueCount(int32_t field_id) const {
+		return GetCount(IcebergColumnStatType::VALUE_COUNT, field_id);
+	}
+	optional<int64_t> NullValueCount(int32_t field_id) const {
+		return GetCount(IcebergColumnStatType::NULL_VALUE_COUNT, field_id);
+	}
+	optional<int64_t> NanValueCount(int32_t field_id) const {
+		return GetCount(IcebergColumnStatType::NAN_VALUE_COUNT, field_id);
+	}
+	optional<string_t> LowerBound(int32_t field_id) const {
+		return GetBound(IcebergColumnStatType::LOWER_BOUND, field_id);
+	}
+	optional<string_t> UpperBound(int32_t field_id) const {
+		return GetBound(IcebergColumnStatType::UPPER_BOUND, field_id);
+	}
+
+public:
+	//! Row-wise access, rows are sorted by field id
+	idx_t FieldCount() const {
+		return count;
+	}
+	int32_t RowFieldId(idx_t row_idx) const {
+		return batch->field_ids[offset + row_idx];
+	}
+	bool RowHasStat(idx_t row_idx, IcebergColumnStatType type) const {
+		return batch->HasStat(offset + row_idx, type);
+	}
+	int64_t RowStatCount(idx_t row_idx, IcebergColumnStatType type) const {
+		return batch->GetCount(offset + row_idx, type);
+	}
+	const string_t &RowBound(idx_t row_idx, IcebergColumnStatType type) const {
+		return batch->GetBound(offset + row_idx, type);
+	}
+
+private:
+	optional_idx FindRow(int32_t field_id) const;
+	//! Make sure this is the only owner of the batch, then return the batch row of 'field_id', creating it if needed
+	idx_t GetOrCreateRow(int32_t field_id);
+
+private:
+	shared_ptr<IcebergColumnStatsBatch> batch;
+	idx_t offset = 0;
+	idx_t count = 0;
+};
+
+} // namespace duckdb
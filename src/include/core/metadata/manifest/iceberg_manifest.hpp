@@ -10,6 +10,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/common/insertion_order_preserving_map.hpp"
 
+#include "core/metadata/manifest/iceberg_column_stats.hpp"
 #include "core/metadata/schema/iceberg_table_schema.hpp"
 #include "core/metadata/iceberg_table_metadata.hpp"
 #include "planning/snapshot/iceberg_snapshot_scan_info.hpp"
@@ -102,13 +103,8 @@ public:
 	int64_t record_count;
 
 	int64_t file_size_in_bytes;
-	unordered_map<int32_t, int64_t> column_sizes;
-	unordered_map<int32_t, int64_t> value_counts;
-	unordered_map<int32_t, int64_t> null_value_counts;
-	unordered_map<int32_t, int64_t> nan_value_counts;
-	//! source_id -> blob
-	unordered_map<int32_t, Value> lower_bounds;
-	unordered_map<int32_t, Value> upper_bounds;
+	//! column_sizes, value_counts, null/NaN value counts and lower/upper bounds (as blobs) by source_id
+	IcebergColumnStats column_stats;
 	vector<int32_t> equality_ids;
 	vector<int64_t> split_offsets;
 
@@ -201,6 +197,45 @@ static constexpr const int32_t REFERENCED_DATA_FILE = 143;
 static constexpr const int32_t CONTENT_OFFSET = 144;
 static constexpr const int32_t CONTENT_SIZE_IN_BYTES = 145;
 
+//! Writes the entries of a manifest file through the Avro copy function one batch at a time, so a manifest can be
+//! written without all of its entries in memory. The file is created on the first 'Append'.
+class ManifestFileWriter {
+public:
+	ManifestFileWriter(const IcebergTableMetadata &table_metadata, const IcebergManifestListEntry &list_entry,
+	                   CopyFunction &copy, DatabaseInstance &db, ClientContext &context);
+	~ManifestFileWriter();
+
+public:
+	void Append(const vector<IcebergManifestEntry> &entries);
+	//! Close the file, returns its size in bytes
+	idx_t Finalize();
+	idx_t RowCount() const {
+		return row_count;
+	}
+
+private:
+	void Initialize(const IcebergManifestEntry &first_entry);
+
+private:
+	const IcebergTableMetadata &table_metadata;
+	const IcebergManifestListEntry &list_entry;
+	CopyFunction &copy;
+	DatabaseInstance &db;
+	ClientContext &context;
+	int32_t manifest_format_version;
+
+	ThreadContext thread_context;
+	ExecutionContext execution_context;
+	unique_ptr<FunctionData> bind_data;
+	unique_ptr<GlobalFunctionData> global_state;
+	unique_ptr<LocalFunctionData> local_state;
+	CopyFunctionFileStatistics stats;
+	DataChunk chunk;
+	//! The partition layout of the file, taken from its first entry
+	vector<IcebergExtendedPartitionInfo> extended_partition_info;
+	idx_t row_count = 0;
+};
+
 //! Writes the manifest file using the precomputed metadata stored on the list entry.
 idx_t WriteToFile(const IcebergTableMetadata &table_metadata, const IcebergManifestListEntry &manifest_entry,
                   CopyFunction &copy_function, DatabaseInstance &db, ClientContext &context);
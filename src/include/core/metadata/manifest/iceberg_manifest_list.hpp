@@ -38,6 +38,26 @@ public:
 	vector<FieldSummary> field_summary;
 };
 
+//! Accumulates the partition field summaries of a manifest one batch of entries at a time, so the entries don't all
+//! have to be held in memory at once
+class ManifestPartitionsBuilder {
+public:
+	ManifestPartitionsBuilder(const IcebergTableMetadata &metadata, const IcebergPartitionSpec &partition_spec);
+
+public:
+	void Update(const vector<IcebergManifestEntry> &entries);
+	void Finalize(ManifestPartitions &result);
+
+private:
+	const IcebergTableMetadata &metadata;
+	const IcebergPartitionSpec &partition_spec;
+	bool has_entries = false;
+	vector<bool> contains_null;
+	vector<Value> min_values;
+	vector<Value> max_values;
+	vector<bool> initialized;
+};
+
 struct IcebergManifestCounts {
 public:
 	static IcebergManifestCounts Zero();
@@ -189,6 +209,10 @@ public:
 	}
 
 public:
+	//! Create the list entry of a new manifest file that has no entries yet
+	static IcebergManifestListEntry CreateEmpty(FileSystem &fs, sequence_number_t sequence_number,
+	                                            const IcebergTableMetadata &table_metadata,
+	                                            const IcebergManifestMetadata &manifest_metadata, int64_t next_row_id);
 	static IcebergManifestListEntry CreateFromEntries(FileSystem &fs, sequence_number_t sequence_number,
 	                                                  const IcebergTableMetadata &table_metadata,
 	                                                  const IcebergManifestMetadata &manifest_metadata,
@@ -220,6 +244,21 @@ public:
 	optional<IcebergManifestMetrics> metrics;
 };
 
+//! Gathers the counts, metrics, minimum sequence number and partition field summaries of a new manifest (created with
+//! 'CreateEmpty') from its entries, which can be passed in batches as they are written
+class ManifestSummaryBuilder {
+public:
+	ManifestSummaryBuilder(const IcebergTableMetadata &table_metadata, IcebergManifestListEntry &list_entry);
+
+public:
+	void Update(const vector<IcebergManifestEntry> &entries, int64_t &next_row_id);
+	void Finalize();
+
+private:
+	IcebergManifestListEntry &list_entry;
+	unique_ptr<ManifestPartitionsBuilder> partitions;
+};
+
 struct IcebergManifestList {
 public:
 	IcebergManifestList(int64_t snapshot_id, sequence_number_t sequence_number, const string &path)
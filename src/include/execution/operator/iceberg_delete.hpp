@@ -67,12 +67,9 @@ struct IcebergDeleteFileInfo {
 	IcebergPartition partition_info;
 	//! When non-empty, this is an equality-delete file; holds the field-ids it applies to
 	vector<int32_t> equality_ids;
-	//! Per-field serialized lower/upper bounds of the equality-delete values (field-id -> bound blob).
-	unordered_map<int32_t, Value> lower_bounds;
-	unordered_map<int32_t, Value> upper_bounds;
-	//! Per-field null/NaN counts used to decide whether bounds can safely prune an equality delete.
-	unordered_map<int32_t, int64_t> null_value_counts;
-	unordered_map<int32_t, int64_t> nan_value_counts;
+	//! Per-field serialized lower/upper bounds of the equality-delete values, and the null/NaN counts used to
+	//! decide whether those bounds can safely prune an equality delete.
+	IcebergColumnStats column_stats;
 };
 
 class IcebergDeleteGlobalState : public GlobalSinkState {
@@ -90,6 +87,8 @@ public:
 	// data file name -> newly deleted rows.
 	unordered_map<string, vector<idx_t>> deleted_rows;
 	IcebergManifestDeletes altered_manifests;
+	//! Copy-on-write: the data files rewritten without their deleted rows, keyed by the spec of the file they replace
+	partitioned_manifest_entry_map_t rewritten_files;
 	//! Guards the one-time write of the equality-delete file (Sink runs in parallel)
 	bool equality_delete_written = false;
 
@@ -144,6 +143,9 @@ public:
 	vector<idx_t> row_id_indexes;
 
 	vector<IcebergEqualityDeletePredicate> equality_predicates;
+	//! Whether the table's write mode is copy-on-write: the affected data files are rewritten without the deleted
+	//! rows and replace the originals, instead of adding delete files that every later read has to apply
+	bool copy_on_write = false;
 
 public:
 	// // Source interface
@@ -156,7 +158,7 @@ public:
 
 	static PhysicalOperator &PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner,
 	                                    IcebergTableSchemaVersion &table, PhysicalOperator &child_plan,
-	                                    vector<idx_t> &&row_id_indexes);
+	                                    vector<idx_t> &&row_id_indexes, bool copy_on_write = false);
 
 	//! Detects whether `child_plan`'s pushed-down filters describe a pure conjunction of equality
 	//! predicates, and if so extracts them into `equality_predicates`. Returns false otherwise.
@@ -190,11 +192,13 @@ public:
 private:
 	//! Walk `plan` for the PhysicalTableScan that emits the row-id virtual columns the delete needs.
 	static optional_ptr<PhysicalTableScan> FindIcebergScan(PhysicalOperator &plan);
-	void WritePositionalDeleteFile(ClientContext &context, IcebergDeleteGlobalState &global_state,
-	                               const string &filename, IcebergDeleteFileInfo delete_file,
-	                               set<idx_t> sorted_deletes) const;
-	void WriteDeletionVectorFile(ClientContext &context, IcebergDeleteGlobalState &global_state, const string &filename,
-	                             IcebergDeleteFileInfo delete_file, const set<idx_t> &sorted_deletes) const;
+	//! Write the deletes of one data file, these run in parallel (one data file per task) so they don't touch the
+	//! global state and return the written file instead
+	IcebergDeleteFileInfo WritePositionalDeleteFile(ClientContext &context, const string &filename,
+	                                                IcebergDeleteFileInfo delete_file,
+	                                                const vector<idx_t> &sorted_deletes) const;
+	//! Copy-on-write: rewrite every data file with deleted rows without them, and invalidate the original files
+	void RewriteDataFiles(ClientContext &context, IcebergDeleteGlobalState &global_state) const;
 	//! Writes the Iceberg equality-delete parquet file (one column per equality field, one row of
 	//! constants) and records it in `global_state.written_files`.
 	void WriteEqualityDeleteFile(ClientContext &context, IcebergDeleteGlobalState &global_state) const;
@@ -18,6 +18,7 @@
 #include "core/metadata/partition/iceberg_partition_spec.hpp"
 #include "core/metadata/schema/iceberg_table_schema.hpp"
 #include "execution/operator/physical_iceberg_create_table.hpp"
+#include "storage/statistics/iceberg_data_file_stats.hpp"
 
 namespace duckdb {
 
@@ -79,6 +80,30 @@ public:
 	vector<unique_ptr<Expression>> projection_list;
 };
 
+//! Turns the WRITTEN_FILE_STATISTICS chunks returned by the copy into manifest entries.
+//! The schema, partition spec and column metrics are resolved once, not for every written file.
+class IcebergWrittenFileDecoder {
+public:
+	IcebergWrittenFileDecoder(ClientContext &context, const string &table_name,
+	                          const IcebergTableMetadata &table_metadata);
+
+public:
+	//! Append a manifest entry for every row of 'chunk' to 'result', returns the total record count of the files
+	idx_t Decode(DataChunk &chunk, vector<IcebergManifestEntry> &result);
+
+public:
+	const IcebergTableMetadata &table_metadata;
+
+private:
+	ClientContext &context;
+	//! Partition column name (as returned by the copy) -> partition spec field
+	case_insensitive_map_t<reference<const IcebergPartitionSpecField>> partition_colname_to_field;
+	optional<int32_t> sort_order_id;
+	IcebergDataFileStats data_file_stats;
+	//! Reused across chunks
+	vector<IcebergReturnColumnStats> column_stats;
+};
+
 class IcebergInsertGlobalState : public GlobalSinkState {
 public:
 	explicit IcebergInsertGlobalState(ClientContext &context);
@@ -91,6 +116,17 @@ public:
 	mutex lock;
 	vector<IcebergManifestEntry> written_files;
 	atomic<idx_t> insert_count;
+
+private:
+	unique_ptr<IcebergWrittenFileDecoder> decoder;
+};
+
+class IcebergInsertLocalState : public LocalSinkState {
+public:
+	unique_ptr<IcebergWrittenFileDecoder> decoder;
+	//! Merged into the global state in Combine
+	vector<IcebergManifestEntry> written_files;
+	idx_t insert_count = 0;
 };
 
 class IcebergInsert : public PhysicalOperator {
@@ -134,9 +170,11 @@ public:
 public:
 	// Sink interface
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 	static PhysicalOperator &PlanCopyForInsert(ClientContext &context, PhysicalPlanGenerator &planner,
 	                                           const IcebergCopyInput &copy_input, optional_ptr<PhysicalOperator> plan);
 	static IcebergCopyOptions GetCopyOptions(ClientContext &context, const IcebergCopyInput &copy_input);
@@ -144,8 +182,6 @@ public:
 	static PhysicalOperator &PlanInsert(ClientContext &context, PhysicalPlanGenerator &planner,
 	                                    IcebergTableSchemaVersion &table);
 	static vector<IcebergManifestEntry> GetInsertManifestEntries(IcebergInsertGlobalState &global_state);
-	static void AddWrittenFiles(IcebergInsertGlobalState &global_state, DataChunk &chunk,
-	                            optional_ptr<TableCatalogEntry> table);
 
 	//! Resolve the catalog entry this insert is targeting. For INSERT INTO this
 	//! is just `this->table`; for CTAS the table is created lazily by an
@@ -157,7 +193,7 @@ public:
 	}
 
 	bool ParallelSink() const override {
-		return false;
+		return true;
 	}
 
 	string GetName() const override;
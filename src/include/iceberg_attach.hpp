@@ -15,6 +15,9 @@ enum class IcebergAuthorizationType : uint8_t { OAUTH2, SIGV4, NONE, INVALID };
 
 enum class IRCAccessDelegationMode : uint8_t { NONE, VENDED_CREDENTIALS };
 
+//! Which snapshots loadTable returns: all of them, or only the ones referenced by a branch or tag ('snapshots=refs')
+enum class IcebergSnapshotLoadingMode : uint8_t { ALL, REFS };
+
 struct IcebergAttachOptions {
 	string catalog_uri;
 	string warehouse;
@@ -34,9 +37,22 @@ struct IcebergAttachOptions {
 	bool purge_requested = false;
 	IRCAccessDelegationMode access_mode = IRCAccessDelegationMode::VENDED_CREDENTIALS;
 	IcebergAuthorizationType authorization_type = IcebergAuthorizationType::INVALID;
+	// with REFS, tables are loaded with their referenced snapshots only, the others are loaded when they are needed
+	IcebergSnapshotLoadingMode snapshot_loading_mode = IcebergSnapshotLoadingMode::ALL;
 	unordered_map<string, Value> options;
 	// max staleness for cached table metadata in minutes (optional - if not set, always request fresh metadata)
 	optional_idx max_table_staleness_micros;
+	// age after which cached table metadata is refreshed in the background while it keeps being served (optional - must
+	// be smaller than max_table_staleness, if not set the metadata is only reloaded once it is stale)
+	optional_idx table_refresh_after_micros;
+	// window in which concurrent appends to the same table are combined into one commit (optional - if not set, every
+	// transaction commits on its own)
+	optional_idx group_commit_window_micros;
+	// load the tables referenced by a query concurrently before the binder looks them up one by one (opt-in: the query
+	// text is parsed again, which only pays off for queries that reference several uncached tables)
+	bool prefetch_tables = false;
+	// memory budget (in bytes) for the plans of recently scanned snapshots, 0 disables the scan plan cache
+	idx_t scan_plan_cache_size = 0;
 };
 
 unordered_map<string, Value> NormalizeIcebergAttachOptions(const unordered_map<string, Value> &options);
@@ -23,4 +23,18 @@ struct IcebergLogType : public LogType {
 	}
 };
 
+//! The manifest merge of a commit: the number of manifests before and after it, and the time it took
+struct IcebergManifestMergeLogType : public LogType {
+	static constexpr const char *NAME = "IcebergManifestMerge";
+	static constexpr LogLevel LEVEL = LogLevel::LOG_INFO;
+
+	//! Construct the log type
+	IcebergManifestMergeLogType();
+
+	static LogicalType GetLogType();
+
+	static string ConstructLogMessage(const string &table_name, idx_t manifests, idx_t merged_manifests,
+	                                  int64_t duration_ms);
+};
+
 } // namespace duckdb
@@ -25,6 +25,14 @@ static string SKIP_PUFFIN_VERIFICATION_CONFIG_VARIABLE = "iceberg_unsafe_skip_pu
 // of a positional delete. This exists only to exercise the equality-delete read path.
 static string ENABLE_EQUALITY_DELETES_CONFIG_VARIABLE = "unsafe_and_disabled_for_iceberg_v3_enable_equality_deletes";
 
+// Directory in which decoded manifests and manifest lists are cached across queries and sessions.
+// Manifest files are immutable, so a cached file stays valid as long as its path and length match.
+// The cache is disabled when this is empty.
+static string MANIFEST_CACHE_DIRECTORY_CONFIG_VARIABLE = "iceberg_manifest_cache_directory";
+// The size (in bytes) the manifest cache directory is trimmed to, the least recently used files are evicted first.
+static string MANIFEST_CACHE_MAX_SIZE_CONFIG_VARIABLE = "iceberg_manifest_cache_max_size";
+static constexpr uint64_t DEFAULT_MANIFEST_CACHE_MAX_SIZE = 1ULL << 30;
+
 static constexpr const char *UNSAFE_STRUCT_NULL_DEFAULT_INTERP_CONFIG_VARIABLE =
     "__iceberg_unsafe_struct_null_default_interp";
 
@@ -18,6 +18,7 @@ struct RewriteCandidate {
 	string file_path;
 	int64_t file_size_in_bytes = 0;
 	int64_t record_count = 0;
+	int32_t partition_spec_id = 0;
 	vector<IcebergPartitionInfo> partition_info;
 };
 
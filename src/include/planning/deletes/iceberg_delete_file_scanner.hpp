@@ -38,8 +38,12 @@ struct IcebergDeleteScanResult {
 };
 
 struct IcebergDeleteFileScanner {
+	//! Read all delete files in parallel on the TaskScheduler, returns once every file is read
 	static IcebergDeleteScanResult ScanFiles(const IcebergDeletePlanningContext &context,
 	                                         const vector<IcebergDeleteScanEntry> &entries);
+	//! Merge positional deletes/deletion vectors of 'source' into 'target', a deletion vector supersedes positional
+	//! deletes of the same data file
+	static void MergePositionalDeletes(position_delete_map_t &target, position_delete_map_t &&source);
 };
 
 } // namespace duckdb
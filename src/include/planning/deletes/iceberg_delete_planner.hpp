@@ -17,7 +17,7 @@ struct IcebergOptions;
 using position_delete_map_t = unordered_map<string, shared_ptr<IcebergDeleteData>>;
 
 struct IcebergDeletePlan {
-	vector<reference<const IcebergEqualityDeleteFile>> equality_deletes;
+	vector<shared_ptr<const IcebergEqualityDeleteFile>> equality_deletes;
 	unique_ptr<DeleteFilter> positional_deletes;
 };
 
@@ -29,6 +29,7 @@ struct IcebergDeletePlanningContext {
 	const IcebergTableMetadata &metadata;
 	const IcebergTableSchema &schema;
 	const IcebergTableFilters &table_filters;
+	const IcebergFilePruner &file_pruner;
 	const vector<BoundIcebergManifestListEntry> &data_manifests;
 	const vector<BoundIcebergManifestListEntry> &delete_manifests;
 	const vector<bool> &delete_manifest_matches;
@@ -4,6 +4,10 @@
 #include "duckdb/common/queue.hpp"
 #include "duckdb/common/mutex.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+
 namespace duckdb {
 
 struct IcebergDataViewCursor;
@@ -28,10 +32,16 @@ public:
 	void PushBatch(ManifestReadBatch &&batch);
 	bool GetBatch(idx_t batch_idx, ManifestReadBatch &result) const;
 	bool TryReadBatch(IcebergDataViewCursor &cursor) const;
+	//! Block until the batch at 'batch_idx' is pushed, 'done' returns true, or 'timeout' passes
+	void WaitForBatch(idx_t batch_idx, const std::function<bool()> &done, std::chrono::milliseconds timeout) const;
+	//! Wake up the consumers waiting for a batch, used by the producers when they finish (or fail)
+	void NotifyConsumers() const;
 
 private:
 	//! Lock guarding the batches against concurrent access
 	mutable mutex lock;
+	//! Signalled when a batch is pushed or a producer finishes
+	mutable std::condition_variable batch_pushed;
 	vector<ManifestReadBatch> batches;
 };
 
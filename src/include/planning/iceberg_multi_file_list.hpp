@@ -35,6 +35,24 @@ struct IcebergScanPlanContext;
 struct IcebergMultiFileList;
 struct IcebergMultiFileReader;
 struct IcebergDeleteFileReference;
+struct IcebergFilePruner;
+
+//! The manifest entry of a data file returned by the list, and the manifest (owned by the list) it was read from
+struct IcebergDataFileEntry {
+	IcebergManifestEntry entry;
+	reference<const IcebergManifestFile> manifest;
+};
+
+//! Counts of the data files selected by a view, taken from the manifest list summaries so that the data manifests
+//! don't have to be read
+struct IcebergScanEstimate {
+	//! The live data files in the data manifests that survive manifest-level pruning
+	idx_t file_count = 0;
+	//! The rows in those files, minus the rows added by the matching delete manifests
+	idx_t row_count = 0;
+	//! False when (part of) the row count is extrapolated from other manifests or a sampled manifest
+	bool exact = true;
+};
 
 struct IcebergMultiFileList : public MultiFileList {
 public:
@@ -58,6 +76,12 @@ public:
 	void SetTable(IcebergTableSchemaVersion &table);
 	shared_ptr<IcebergDeleteData> GetExistingPositionalDeleteData(const string &file_path) const;
 	IcebergPartition GetPartitionForDataFile(const string &file_path) const;
+	//! The manifest entries of data files returned by this list (keyed by the path the scan emitted), with the
+	//! sequence numbers and first row id they inherit from their manifest made explicit
+	unordered_map<string, IcebergDataFileEntry> GetEntriesForDataFiles(const unordered_set<string> &file_paths) const;
+	//! The manifest a data (or delete) manifest entry of this list was read from
+	const IcebergManifestFile &GetSourceManifest(const BoundIcebergManifestEntry &entry,
+	                                             IcebergManifestContentType type) const;
 	void SetScanOrder(unique_ptr<RowGroupOrderOptions> options);
 	optional_ptr<IcebergTableSchemaVersion> GetTable() const;
 	void DisableServerSidePlanning();
@@ -113,8 +137,14 @@ private:
 	void InitializeScanPlanProvider() const DUCKDB_REQUIRES(shared_state->lock);
 	void StartDataManifestScan(annotated_lock_guard<annotated_mutex> &guard) const DUCKDB_REQUIRES(shared_state->lock);
 	IcebergScanPlanProvider &GetScanPlanProvider() const DUCKDB_REQUIRES(shared_state->lock);
+	const IcebergFilePruner &GetFilePruner() const DUCKDB_REQUIRES(shared_state->lock);
 	IcebergScanPlanContext GetScanPlanContext() const DUCKDB_REQUIRES(shared_state->lock);
 	IcebergDeletePlanningContext GetDeletePlanningContext() const DUCKDB_REQUIRES(shared_state->lock);
+	const IcebergScanEstimate &GetScanEstimate(annotated_lock_guard<annotated_mutex> &guard) const
+	    DUCKDB_REQUIRES(shared_state->lock);
+	//! Read the smallest of 'manifests' to estimate the rows per data file of manifests that lack row counts
+	double SampleRowsPerFile(const vector<reference<const IcebergManifestListEntry>> &manifests) const
+	    DUCKDB_REQUIRES(shared_state->lock);
 
 private:
 	shared_ptr<IcebergScanPlanState> shared_state;
@@ -130,6 +160,8 @@ private:
 	//! The provider is per-view. The server-side implementation owns its filter-derived plan, while the client-side
 	//! implementation delegates to the shared manifest state above.
 	mutable unique_ptr<IcebergScanPlanProvider> scan_plan_provider DUCKDB_GUARDED_BY(shared_state->lock);
+	//! The 'table_filters' compiled for pruning, created once and used for every manifest and manifest entry
+	mutable unique_ptr<IcebergFilePruner> file_pruner DUCKDB_GUARDED_BY(shared_state->lock);
 
 	//! Combination of committed + transaction delete manifests
 	mutable vector<BoundIcebergManifestListEntry> delete_manifests DUCKDB_GUARDED_BY(shared_state->lock);
@@ -143,6 +175,9 @@ private:
 	//! Combination of committed + transaction data manifests
 	mutable vector<BoundIcebergManifestListEntry> data_manifests DUCKDB_GUARDED_BY(shared_state->lock);
 	mutable vector<bool> data_manifest_matches DUCKDB_GUARDED_BY(shared_state->lock);
+	//! Whether every data file of the view is in 'data_manifest_entries'
+	mutable bool data_files_exhausted DUCKDB_GUARDED_BY(shared_state->lock) = false;
+	mutable unique_ptr<IcebergScanEstimate> scan_estimate DUCKDB_GUARDED_BY(shared_state->lock);
 
 	//! Set by the table function's set_scan_order callback when an ORDER BY ... LIMIT can drive scan order.
 	mutable IcebergScanOrder scan_order DUCKDB_GUARDED_BY(shared_state->lock);
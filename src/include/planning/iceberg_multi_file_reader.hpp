@@ -30,6 +30,14 @@ struct IcebergEqualityDeleteReadColumn {
 	LogicalType type;
 };
 
+//! An equality delete file with its key columns resolved against the data file being read
+struct IcebergEqualityDeleteProbe {
+	shared_ptr<const IcebergEqualityDeleteFile> delete_file;
+	//! Index into the read state 'columns' for every equality id, INVALID_INDEX if the data file lacks the field
+	vector<idx_t> key_columns;
+	vector<LogicalType> key_types;
+};
+
 struct IcebergEqualityDeleteReadState {
 	explicit IcebergEqualityDeleteReadState(vector<IcebergEqualityDeleteReadColumn> columns_p)
 	    : columns(std::move(columns_p)) {
@@ -42,7 +50,7 @@ struct IcebergEqualityDeleteReadState {
 	vector<IcebergEqualityDeleteReadColumn> columns;
 	vector<LogicalType> types;
 	unordered_map<int32_t, idx_t> field_indexes;
-	unique_ptr<Expression> expression;
+	vector<IcebergEqualityDeleteProbe> probes;
 };
 
 struct IcebergMultiFileReaderGlobalState : public MultiFileReaderGlobalState {
@@ -121,13 +129,15 @@ public:
 	                           const LogicalType &type, MultiFileLocalIndex local_idx) override;
 
 private:
-	static unique_ptr<Expression>
-	CreateEqualityDeleteExpression(const vector<reference<const IcebergEqualityDeleteFile>> &delete_files,
-	                               const vector<MultiFileColumnDefinition> &local_columns,
-	                               const IcebergEqualityDeleteReadState &read_state);
+	static void CreateEqualityDeleteProbes(const vector<shared_ptr<const IcebergEqualityDeleteFile>> &delete_files,
+	                                       const vector<MultiFileColumnDefinition> &local_columns,
+	                                       sequence_number_t data_sequence_number,
+	                                       IcebergEqualityDeleteReadState &read_state, ClientContext &context);
+	static idx_t FilterEqualityDeletes(const IcebergEqualityDeleteReadState &read_state, DataChunk &values,
+	                                   SelectionVector &result);
 	static vector<IcebergEqualityDeleteReadColumn>
 	AddEqualityDeleteColumns(const IcebergTableMetadata &metadata,
-	                         const vector<reference<const IcebergEqualityDeleteFile>> &delete_files,
+	                         const vector<shared_ptr<const IcebergEqualityDeleteFile>> &delete_files,
 	                         vector<MultiFileColumnDefinition> &scan_columns, vector<ColumnIndex> &scan_column_ids,
 	                         MultiFileReaderData &reader_data, ClientContext &context);
 	static IcebergEqualityDeleteReadColumn
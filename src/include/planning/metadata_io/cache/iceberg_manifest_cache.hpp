@@ -0,0 +1,46 @@
+#pragma once
+
+#include "core/metadata/manifest/iceberg_manifest_list.hpp"
+
+namespace duckdb {
+
+class FileSystem;
+struct IcebergManifestCacheDirectory;
+
+//! A local, size-bounded cache of decoded manifest lists and manifests.
+//! Manifest (list) files are never modified once written, so a decoded file stays valid for as long as a file with
+//! the same path and length exists. Every file is cached in a file of its own in the cache directory, in a compact
+//! binary layout that is decoded with a single read.
+class IcebergManifestCache {
+public:
+	IcebergManifestCache(ClientContext &context, string directory, idx_t max_size);
+
+public:
+	//! Returns nullptr if no cache directory is configured
+	static unique_ptr<IcebergManifestCache> TryCreate(ClientContext &context);
+
+	//! Try to load the decoded entries of the manifest list at 'path', returns false on a miss
+	bool TryLoadManifestList(const string &path, idx_t iceberg_version, vector<IcebergManifestListEntry> &result);
+	void StoreManifestList(const string &path, idx_t iceberg_version, const vector<IcebergManifestListEntry> &entries);
+	//! Try to load the decoded manifest entries (and manifest metadata) of 'manifest', returns false on a miss
+	bool TryLoadManifest(IcebergManifestListEntry &manifest, idx_t iceberg_version);
+	//! Store the manifests that have their entries loaded, then evict the least recently used files if
+	//! the cache is too big
+	void StoreManifests(const vector<reference<const IcebergManifestListEntry>> &manifests, idx_t iceberg_version);
+
+private:
+	string GetCachePath(const string &key) const;
+	bool TryRead(const string &key, string &result);
+	void Write(const string &key, const string &payload);
+	void EnforceSizeLimit();
+
+private:
+	ClientContext &context;
+	FileSystem &fs;
+	string directory;
+	idx_t max_size;
+	//! Running size and access times of the directory, shared with the other caches that use it
+	shared_ptr<IcebergManifestCacheDirectory> state;
+};
+
+} // namespace duckdb
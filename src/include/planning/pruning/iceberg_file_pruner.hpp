@@ -7,15 +7,64 @@
 
 namespace duckdb {
 
+//! A filter that is a conjunction of comparisons between an integral column and constants, evaluated directly on
+//! the serialized manifest bounds instead of deserializing them into Values first
+struct IcebergIntegralBoundsKernel {
+public:
+	struct Comparison {
+		ExpressionType type;
+		int64_t constant;
+	};
+
+public:
+	//! Returns false if the filter can not be evaluated by the kernel
+	bool Compile(const Expression &expr, const LogicalType &column_type);
+	//! Returns false if the bound does not have the expected encoding, the generic path reports that
+	bool TryDecode(const string_t &bound, int64_t &result) const;
+	bool Matches(int64_t lower_bound, int64_t upper_bound) const;
+
+public:
+	LogicalTypeId type_id = LogicalTypeId::INVALID;
+	vector<Comparison> comparisons;
+};
+
+//! A table filter on a top-level column, resolved against the schema
+struct IcebergColumnPruningStep {
+	IcebergColumnPruningStep(const IcebergColumnDefinition &column, const ExpressionFilter &filter)
+	    : column(column), filter(filter) {
+	}
+
+	const IcebergColumnDefinition &column;
+	const ExpressionFilter &filter;
+	//! Only set if the filter could be compiled into a kernel
+	unique_ptr<IcebergIntegralBoundsKernel> kernel;
+};
+
+//! A partition field of a partition spec that is filtered on, with the part of the filter that applies to it
+struct IcebergPartitionPruningStep {
+	//! The index of the field in the partition spec (and the manifest's field summaries)
+	idx_t field_idx;
+	const IcebergPartitionSpecField &field;
+	const IcebergColumnDefinition &source_column;
+	//! Mirrors the field id the NaN count of the partition source is looked up by
+	int32_t nan_count_field_id;
+	unique_ptr<ExpressionFilter> filter;
+};
+
+//! Prunes manifests and manifest entries on the filters of a scan. The filters are compiled once, on construction,
+//! into pruning steps with the field ids, column types and partition fields already resolved, so the pruner should
+//! be created once per scan and reused for every manifest and entry.
 struct IcebergFilePruner {
 public:
 	IcebergFilePruner(ClientContext &context, const IcebergTableMetadata &metadata, const IcebergTableSchema &schema,
-	                  const IcebergTableFilters &table_filters)
-	    : context(context), metadata(metadata), schema(schema), table_filters(table_filters) {
-	}
+	                  const IcebergTableFilters &table_filters);
 
 	bool ManifestMatchesFilter(const IcebergManifestFile &manifest) const;
 	bool FileMatchesFilter(const IcebergManifestFile &manifest_file, const IcebergManifestEntry &manifest_entry) const;
+	//! Evaluate the filters for the manifest entries [begin, end) at once, 'matches' receives one entry per file.
+	//! Deleted entries never match.
+	void FilterFiles(const IcebergManifestFile &manifest_file, const vector<IcebergManifestEntry> &manifest_entries,
+	                 idx_t begin, idx_t end, vector<bool> &matches) const;
 	bool DeleteManifestMatchesDataFile(const IcebergManifestFile &delete_manifest,
 	                                   const IcebergManifestFile &data_manifest,
 	                                   const IcebergManifestEntry &data_manifest_entry) const;
@@ -28,7 +77,15 @@ public:
 	static partition_value_map_t PartitionValueMap(const IcebergDataFile &data_file);
 
 private:
-	bool FilePartitionMatchesFilter(const IcebergDataFile &data_file, const IcebergManifestFile &manifest_file) const;
+	using file_selection_t = vector<reference<const IcebergManifestEntry>>;
+
+	void CompileColumnSteps();
+	void CompilePartitionSteps();
+	//! Remove the files that do not match the filters from 'files'
+	void PruneFiles(const IcebergManifestFile &manifest_file, file_selection_t &files) const;
+	void PruneFilesOnPartition(const IcebergManifestFile &manifest_file, file_selection_t &files) const;
+	void PruneFilesOnColumnStats(file_selection_t &files) const;
+	bool FileMatchesColumnStep(const IcebergDataFile &data_file, const IcebergColumnPruningStep &step) const;
 	bool EqualityDeleteMatchesDataFile(const IcebergDataFile &delete_file, const IcebergDataFile &data_file) const;
 
 private:
@@ -36,6 +93,11 @@ private:
 	const IcebergTableMetadata &metadata;
 	const IcebergTableSchema &schema;
 	const IcebergTableFilters &table_filters;
+	//! The field ids that have a name mapping, only these columns can be pruned on when the table has mappings
+	unordered_set<int32_t> mapping_field_ids;
+	vector<IcebergColumnPruningStep> column_steps;
+	//! partition spec id -> the steps of the fields that are filtered on
+	unordered_map<int32_t, vector<IcebergPartitionPruningStep>> partition_steps;
 };
 
 } // namespace duckdb
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "planning/scan_plan/iceberg_scan_plan_state.hpp"
+
+namespace duckdb {
+
+class IcebergSnapshot;
+struct IcebergTableMetadata;
+
+//! The planning work done by a scan of a committed snapshot: the manifests it loaded and the delete files it read
+struct IcebergCachedScanPlan {
+public:
+	//! Rough estimate of the memory held by the plan, used for the memory budget of the cache
+	idx_t EstimateMemorySize() const;
+
+public:
+	vector<IcebergManifestListEntry> data_manifests;
+	//! Whether the entries of the data manifest are loaded
+	vector<bool> loaded_data_manifests;
+	//! Only the delete manifests that were loaded have their entries set
+	vector<IcebergManifestListEntry> delete_manifests;
+	//! The delete files that were read, by delete manifest
+	vector<unordered_map<idx_t, shared_ptr<IcebergDeleteFileLoadState>>> delete_file_loads;
+	//! Declared after the manifests, the delete data references their entries
+	unordered_map<string, shared_ptr<IcebergDeleteData>> positional_delete_data;
+};
+
+//! An LRU cache of planned snapshots, keyed by table uuid and snapshot id.
+//! A scan takes the plan of its snapshot out of the cache and puts it back (including whatever it loaded on top of
+//! it) once the scan is destroyed. The delete data references the manifests, so a plan is moved around and never
+//! shared: a concurrent scan of the same snapshot finds no plan and plans from scratch.
+class IcebergScanPlanCache {
+public:
+	explicit IcebergScanPlanCache(idx_t max_memory);
+
+public:
+	//! Returns an empty string if the snapshot can't be cached (the table or snapshot has no id)
+	static string GetKey(const IcebergTableMetadata &metadata, const IcebergSnapshot &snapshot);
+	bool Enabled() const {
+		return max_memory != 0;
+	}
+	//! Remove the plan for 'key' from the cache, returns nullptr if there is none
+	unique_ptr<IcebergCachedScanPlan> Take(const string &key);
+	//! Add (or replace) the plan for 'key', then evict the least recently used plans until the budget is met
+	void Put(const string &key, unique_ptr<IcebergCachedScanPlan> plan);
+
+private:
+	struct CacheEntry {
+		string key;
+		unique_ptr<IcebergCachedScanPlan> plan;
+		idx_t memory_size;
+	};
+	void Erase(list<CacheEntry>::iterator it) DUCKDB_REQUIRES(lock);
+
+private:
+	const idx_t max_memory;
+	annotated_mutex lock;
+	//! Most recently used first
+	list<CacheEntry> plans DUCKDB_GUARDED_BY(lock);
+	unordered_map<string, list<CacheEntry>::iterator> plan_map DUCKDB_GUARDED_BY(lock);
+	idx_t memory_usage DUCKDB_GUARDED_BY(lock) = 0;
+};
+
+} // namespace duckdb
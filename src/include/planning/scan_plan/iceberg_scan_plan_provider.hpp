@@ -72,6 +72,10 @@ public:
 	    DUCKDB_REQUIRES(shared_state.lock, shared_state.delete_lock);
 	position_delete_map_t &PositionalDeleteData() override DUCKDB_REQUIRES(shared_state.delete_lock);
 
+private:
+	//! Pick up the plan of an earlier scan of this snapshot from the scan plan cache of the catalog
+	bool TryRestoreCachedScanPlan() DUCKDB_REQUIRES(shared_state.lock);
+
 private:
 	IcebergScanPlanState &shared_state;
 	IcebergScanPlanContext context;
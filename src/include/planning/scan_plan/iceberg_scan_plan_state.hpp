@@ -7,6 +7,7 @@
 #include "duckdb/parallel/task_executor.hpp"
 #include "planning/iceberg_manifest_read_state.hpp"
 #include "planning/metadata_io/avro/avro_scan.hpp"
+#include "planning/metadata_io/cache/iceberg_manifest_cache.hpp"
 #include "planning/metadata_io/manifest/bound_iceberg_manifest_entry.hpp"
 #include "planning/snapshot/iceberg_scan_info.hpp"
 
@@ -15,6 +16,7 @@
 namespace duckdb {
 
 class IcebergTableSchemaVersion;
+class IcebergScanPlanCache;
 struct IcebergDeleteManifestLoadState;
 
 struct IcebergDeleteFileLoadState {
@@ -27,14 +29,18 @@ struct IcebergDeleteFileLoadState {
 
 struct IcebergManifestScanningState {
 	IcebergManifestScanningState(ClientContext &context, unique_ptr<AvroScan> scan,
-	                             vector<IcebergManifestListEntry> &list_entries)
-	    : context(context), executor(context), scan(std::move(scan)), list_entries(list_entries), in_progress_tasks(0) {
+	                             vector<IcebergManifestListEntry> &list_entries,
+	                             optional_ptr<ManifestEntryReadState> read_state = nullptr)
+	    : context(context), executor(context), scan(std::move(scan)), list_entries(list_entries),
+	      read_state(read_state), in_progress_tasks(0) {
 	}
 
 	ClientContext &context;
 	TaskExecutor executor;
 	unique_ptr<AvroScan> scan;
 	vector<IcebergManifestListEntry> &list_entries;
+	//! The batches the scan publishes to, its consumers are notified when a read task finishes
+	optional_ptr<ManifestEntryReadState> read_state;
 	atomic<idx_t> in_progress_tasks;
 };
 
@@ -43,6 +49,10 @@ struct IcebergDataViewCursor {
 	bool has_current_batch = false;
 	ManifestReadBatch current_batch;
 	idx_t current_batch_offset = 0;
+	//! Whether 'current_batch_matches' has been computed for the current batch
+	bool current_batch_filtered = false;
+	//! For every entry of the current batch (from 'start_index'), whether it survives the filters of the view
+	vector<bool> current_batch_matches;
 };
 
 //! State shared by filtered views of one Iceberg scan. Providers own the algorithms
@@ -62,6 +72,12 @@ struct IcebergScanPlanState {
 	mutable annotated_mutex lock;
 	mutable annotated_mutex delete_lock DUCKDB_ACQUIRED_AFTER(lock);
 	mutable ManifestEntryReadState read_state;
+	//! The local manifest cache, or nullptr if it is disabled
+	unique_ptr<IcebergManifestCache> manifest_cache;
+	//! The scan plan cache of the catalog the table belongs to, if any
+	shared_ptr<IcebergScanPlanCache> scan_plan_cache;
+	//! When set, the committed manifests and delete data are put in 'scan_plan_cache' once this state is destroyed
+	string scan_plan_cache_key DUCKDB_GUARDED_BY(lock);
 
 	mutable bool server_side_planning_enabled DUCKDB_GUARDED_BY(lock) = true;
 	mutable bool manifest_list_loaded DUCKDB_GUARDED_BY(lock) = false;
@@ -74,16 +90,23 @@ struct IcebergScanPlanState {
 	    delete_file_loads DUCKDB_GUARDED_BY(delete_lock);
 
 	mutable vector<IcebergManifestListEntry> committed_data_manifests DUCKDB_GUARDED_BY(lock);
-	//! Keep track of which manifests we had to eagerly load, so we can emit batches for them once the data scan is
-	//! started
+	//! Keep track of which manifests are loaded before the data scan is started (eagerly, or by an earlier scan of
+	//! the same snapshot), so we can emit batches for them once the data scan is started
 	mutable vector<bool> eagerly_loaded_data_manifests DUCKDB_GUARDED_BY(lock);
 	mutable vector<reference<const IcebergManifestListEntry>> transaction_data_manifests DUCKDB_GUARDED_BY(lock);
 	mutable unique_ptr<IcebergManifestScanningState> data_manifest_read_state DUCKDB_GUARDED_BY(lock);
+	//! The committed data manifests that are read by 'data_manifest_read_state', marked as loaded (and stored in the
+	//! manifest cache) once the scan is finished
+	mutable vector<idx_t> scanned_data_manifests DUCKDB_GUARDED_BY(lock);
 
 	//! Declared after manifest owners so references in parsed positional-delete data are destroyed first.
 	mutable unordered_map<string, shared_ptr<IcebergDeleteData>> positional_delete_data DUCKDB_GUARDED_BY(delete_lock);
 
 	mutable unordered_map<string, IcebergPartition> data_file_partitions DUCKDB_GUARDED_BY(lock);
+
+private:
+	//! Hand the committed manifests and the delete data that was read to 'scan_plan_cache'
+	void ReturnScanPlanToCache();
 };
 
 } // namespace duckdb
@@ -6,19 +6,53 @@
 #pragma once
 
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_context.hpp"
 
 #include "core/metadata/manifest/iceberg_manifest.hpp"
 #include "core/metadata/iceberg_table_metadata.hpp"
+#include "core/expression/iceberg_metrics.hpp"
+#include "storage/statistics/iceberg_statistics.hpp"
 
 namespace duckdb {
 
-struct IcebergDataFileStats {
+//! The RETURN_STATS of one column of a written file
+struct IcebergReturnColumnStats {
+	//! The quoted column path, e.g. "s"."a"
+	string column_name;
+	vector<IcebergReturnStat> stats;
+};
+
+class IcebergDataFileStats {
+public:
+	IcebergDataFileStats(ClientContext &context, const IcebergTableMetadata &table_metadata, const string &table_name);
+
+public:
 	//! Populate lower/upper bounds, value/null counts, and column sizes on
-	//! `data_file` from one COPY RETURN_STATS `column_statistics` map value.
+	//! `data_file` from the COPY RETURN_STATS `column_statistics` of the file.
 	//! Respects write.metadata.metrics.* and enforces NOT NULL constraints.
-	static void PopulateFromReturnStats(ClientContext &context, IcebergDataFile &data_file, const Value &column_stats,
-	                                    const IcebergTableMetadata &table_metadata, const string &table_name);
+	void PopulateFromReturnStats(IcebergDataFile &data_file, const vector<IcebergReturnColumnStats> &column_stats);
+
+private:
+	//! A RETURN_STATS column name resolved against the schema, every written file reports the same columns
+	struct ResolvedColumn {
+		vector<string> column_names;
+		optional_ptr<const IcebergColumnDefinition> column_info;
+		//! Set when the path descends into a variant
+		optional_idx name_offset;
+		bool skip = false;
+		bool is_map = false;
+		IcebergMetricsConfig metrics;
+	};
+	const ResolvedColumn &ResolveColumn(const string &column_name);
+
+private:
+	ClientContext &context;
+	const IcebergTableMetadata &table_metadata;
+	string table_name;
+	const IcebergTableSchema &schema;
+	IcebergMetricsConfig default_metrics;
+	unordered_map<string, ResolvedColumn> resolved_columns;
 };
 
 } // namespace duckdb
@@ -14,6 +14,12 @@
 
 namespace duckdb {
 
+//! One (name, value) statistic of a column, as returned by the COPY's RETURN_STATS
+struct IcebergReturnStat {
+	string name;
+	string value;
+};
+
 struct IcebergColumnStats {
 	explicit IcebergColumnStats(LogicalType type_p) : type(std::move(type_p)) {
 	}
@@ -52,7 +58,7 @@ public:
 	unique_ptr<BaseStatistics> ToStats() const;
 	void MergeStats(const IcebergColumnStats &new_stats);
 	IcebergColumnStats Copy() const;
-	static IcebergColumnStats ParseColumnStats(const LogicalType &type, const vector<Value> &col_stats,
+	static IcebergColumnStats ParseColumnStats(const LogicalType &type, const vector<IcebergReturnStat> &col_stats,
 	                                           ClientContext &context);
 
 private:
@@ -12,6 +12,8 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/optional.hpp"
 
+#include "storage/statistics/iceberg_statistics.hpp"
+
 namespace duckdb {
 class ClientContext;
 
@@ -24,8 +26,9 @@ public:
 	//! Ingest one stats entry whose path descends into the variant.
 	//! full_path is the parsed (unquoted) column path, e.g. {"v","typed_value","age","typed_value"}.
 	//! variant_field_start is the index of the first path element inside the variant (the name_offset
-	//! returned by IcebergTableSchema::GetFromPath). col_stats is the list of (name, value) stat structs.
-	void AddStatsEntry(const vector<string> &full_path, idx_t variant_field_start, const vector<Value> &col_stats);
+	//! returned by IcebergTableSchema::GetFromPath). col_stats is the list of (name, value) stats.
+	void AddStatsEntry(const vector<string> &full_path, idx_t variant_field_start,
+	                   const vector<IcebergReturnStat> &col_stats);
 
 	//! True if a shredding type and at least one shredded field bound were collected.
 	bool HasBounds() const;
@@ -70,7 +70,7 @@ void CommitRewrite(ClientContext &context, const RewritePlan &plan, RewriteExecu
 	auto &iceberg_transaction = IcebergTransaction::Get(context, table_info.catalog);
 	IcebergManifestDeletes deletes;
 	for (auto &cand : result.rewritten_candidates) {
-		deletes.InvalidateFile(cand.file_path);
+		deletes.InvalidateFile(cand.file_path, IcebergPartition {cand.partition_spec_id, cand.partition_info});
 	}
 
 	ApplyTableUpdate(table_info, iceberg_transaction, [&](IcebergTable &tbl) {
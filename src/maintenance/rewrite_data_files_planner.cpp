@@ -214,6 +214,7 @@ RewritePlan PlanRewrite(ClientContext &context, const RewriteDataFilesPlanInput
 			cand.file_path = entry.data_file.file_path;
 			cand.file_size_in_bytes = entry.data_file.file_size_in_bytes;
 			cand.record_count = entry.data_file.record_count;
+			cand.partition_spec_id = list_entry.file.partition_spec_id;
 			cand.partition_info = entry.data_file.partition_info;
 			plan.candidates.push_back(std::move(cand));
 		}
@@ -9,6 +9,8 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/logging/logger.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
@@ -18,6 +20,7 @@
 #include "planning/scan_plan/iceberg_scan_plan_provider.hpp"
 #include "planning/metadata_io/deletes/iceberg_deletes_file_reader.hpp"
 
+#include <algorithm>
 #include <variant>
 
 namespace duckdb {
@@ -39,9 +42,12 @@ namespace {
 
 using PuffinDeletionVectorVerificationResult = std::variant<std::monostate, string>;
 
-static PuffinDeletionVectorVerificationResult VerifyPuffinDeletionVector(FileSystem &fs, FileHandle &handle,
-                                                                         int64_t content_offset, int64_t content_size) {
-	auto footer_result = IcebergPuffinReader::ReadFooter(fs, handle, handle.GetPath());
+//! Reads of deletion vector blobs in the same Puffin file that are at most this many bytes apart are coalesced
+static constexpr int64_t PUFFIN_COALESCED_READ_MAX_GAP = 1024 * 1024;
+
+static PuffinDeletionVectorVerificationResult
+VerifyPuffinDeletionVector(const IcebergPuffinFileFooterResult &footer_result, int64_t content_offset,
+                           int64_t content_size) {
 	if (auto error = std::get_if<string>(&footer_result)) {
 		return *error;
 	}
@@ -63,10 +69,7 @@ static PuffinDeletionVectorVerificationResult VerifyPuffinDeletionVector(FileSys
 	return std::monostate {};
 }
 
-static void ScanPuffinFile(const IcebergDeletePlanningContext &context, const IcebergDeleteScanEntry &scan_entry,
-                           IcebergDeleteScanResult &scan_result) {
-	auto bound_entry = scan_entry.BindEntry();
-	auto &data_file = bound_entry.entry.data_file;
+static void VerifyPuffinDeleteEntry(const IcebergDeletePlanningContext &context, const IcebergDataFile &data_file) {
 	if (context.metadata.iceberg_version < 3) {
 		throw InvalidConfigurationException("DeletionVector not supported in Iceberg V%d",
 		                                    context.metadata.iceberg_version);
@@ -74,42 +77,92 @@ static void ScanPuffinFile(const IcebergDeletePlanningContext &context, const Ic
 	if (!data_file.referenced_data_file) {
 		throw InvalidConfigurationException("Puffin delete file is missing 'referenced_data_file'");
 	}
-
-	FileOpenFlags flags = FileFlags::FILE_FLAGS_READ;
-	flags.SetCachingMode(CachingMode::CACHE_REMOTE_ONLY);
-	auto file_handle = context.fs.OpenFile(data_file.file_path, flags);
 	if (!data_file.content_offset) {
 		throw InvalidConfigurationException("Puffin delete file is missing 'content_offset");
 	}
 	if (!data_file.content_size_in_bytes) {
 		throw InvalidConfigurationException("Puffin delete file is missing 'content_size_in_bytes");
 	}
+}
+
+//! Read all requested deletion vectors of a single Puffin file: the file is opened (and its footer verified) once,
+//! and blobs that are close together are fetched with a single coalesced read.
+static void ScanPuffinFile(const IcebergDeletePlanningContext &context,
+                           vector<reference<const IcebergDeleteScanEntry>> scan_entries,
+                           IcebergDeleteScanResult &scan_result) {
+	D_ASSERT(!scan_entries.empty());
+	for (auto &scan_entry : scan_entries) {
+		VerifyPuffinDeleteEntry(context, scan_entry.get().GetEntry().data_file);
+	}
+	std::sort(scan_entries.begin(), scan_entries.end(),
+	          [](const IcebergDeleteScanEntry &a, const IcebergDeleteScanEntry &b) {
+		          return *a.GetEntry().data_file.content_offset < *b.GetEntry().data_file.content_offset;
+	          });
+	vector<BoundIcebergManifestEntry> bound_entries;
+	bound_entries.reserve(scan_entries.size());
+	for (auto &scan_entry : scan_entries) {
+		bound_entries.push_back(scan_entry.get().BindEntry());
+	}
 
-	auto offset = *data_file.content_offset;
-	auto length = *data_file.content_size_in_bytes;
-	auto local_buffer = Allocator::DefaultAllocator().Allocate(length);
-	context.fs.Read(*file_handle, local_buffer.get(), length, offset);
+	auto &file_path = bound_entries[0].entry.data_file.file_path;
+	FileOpenFlags flags = FileFlags::FILE_FLAGS_READ;
+	flags.SetCachingMode(CachingMode::CACHE_REMOTE_ONLY);
+	auto file_handle = context.fs.OpenFile(file_path, flags);
 
 	Value skip_verification;
-	if (!context.context.TryGetCurrentSetting(SKIP_PUFFIN_VERIFICATION_CONFIG_VARIABLE, skip_verification) ||
-	    !skip_verification.GetValue<bool>()) {
-		auto verification_result = VerifyPuffinDeletionVector(context.fs, *file_handle, offset, length);
-		if (auto error = std::get_if<string>(&verification_result)) {
-			throw InvalidConfigurationException("%s. Older versions of DuckDB wrote deletion vector files as bare "
-			                                    "blobs. To read those files, run \"SET "
-			                                    "%s = true\"",
-			                                    *error, SKIP_PUFFIN_VERIFICATION_CONFIG_VARIABLE);
-		}
+	bool verify = !context.context.TryGetCurrentSetting(SKIP_PUFFIN_VERIFICATION_CONFIG_VARIABLE, skip_verification) ||
+	              !skip_verification.GetValue<bool>();
+	IcebergPuffinFileFooterResult footer_result;
+	if (verify) {
+		footer_result = IcebergPuffinReader::ReadFooter(context.fs, *file_handle, file_handle->GetPath());
 	}
 
 	auto &positional_delete_data = scan_result.positional_delete_data;
-	auto it = positional_delete_data.find(*data_file.referenced_data_file);
-	if (it != positional_delete_data.end() && it->second->type == IcebergDeleteType::DELETION_VECTOR) {
-		throw InvalidConfigurationException(
-		    "Table is corrupt, two or more deletion vectors exist for the same referenced_data_file");
+	idx_t range_begin = 0;
+	while (range_begin < bound_entries.size()) {
+		auto &first_file = bound_entries[range_begin].entry.data_file;
+		auto range_start = *first_file.content_offset;
+		auto range_end = range_start + *first_file.content_size_in_bytes;
+		idx_t range_stop = range_begin + 1;
+		for (; range_stop < bound_entries.size(); range_stop++) {
+			auto &data_file = bound_entries[range_stop].entry.data_file;
+			if (*data_file.content_offset > range_end + PUFFIN_COALESCED_READ_MAX_GAP) {
+				break;
+			}
+			range_end = MaxValue(range_end, *data_file.content_offset + *data_file.content_size_in_bytes);
+		}
+
+		auto range_length = NumericCast<idx_t>(range_end - range_start);
+		auto range_buffer = Allocator::DefaultAllocator().Allocate(range_length);
+		context.fs.Read(*file_handle, range_buffer.get(), range_length, range_start);
+
+		for (idx_t entry_idx = range_begin; entry_idx < range_stop; entry_idx++) {
+			auto &bound_entry = bound_entries[entry_idx];
+			auto &data_file = bound_entry.entry.data_file;
+			auto offset = *data_file.content_offset;
+			auto length = *data_file.content_size_in_bytes;
+			if (verify) {
+				auto verification_result = VerifyPuffinDeletionVector(footer_result, offset, length);
+				if (auto error = std::get_if<string>(&verification_result)) {
+					throw InvalidConfigurationException(
+					    "%s. Older versions of DuckDB wrote deletion vector files as bare "
+					    "blobs. To read those files, run \"SET "
+					    "%s = true\"",
+					    *error, SKIP_PUFFIN_VERIFICATION_CONFIG_VARIABLE);
+				}
+			}
+
+			auto it = positional_delete_data.find(*data_file.referenced_data_file);
+			if (it != positional_delete_data.end() && it->second->type == IcebergDeleteType::DELETION_VECTOR) {
+				throw InvalidConfigurationException(
+				    "Table is corrupt, two or more deletion vectors exist for the same referenced_data_file");
+			}
+			auto blob_start = range_buffer.get() + (offset - range_start);
+			positional_delete_data[*data_file.referenced_data_file] =
+			    IcebergDeletionVectorData::FromBlob(bound_entry, blob_start, length);
+		}
+		range_begin = range_stop;
 	}
-	positional_delete_data[*data_file.referenced_data_file] =
-	    IcebergDeletionVectorData::FromBlob(bound_entry, local_buffer.get(), length);
 }
 
 static optional_ptr<IcebergPositionalDeleteData> TryGetOrCreatePositionDeletes(position_delete_map_t &deletes,
@@ -145,9 +198,15 @@ static void ScanPositionalDeleteFile(const IcebergDeletePlanningContext &context
 	           "Iceberg Delete Scan, read 'positional_delete_file': '%s', referencing 'data_file': '%s'",
 	           bound_entry.entry.data_file.file_path, initial_key);
 
+	//! Rows are sorted by file path, so every run of rows referencing the same data file is added at once
+	idx_t run_start = 0;
 	for (idx_t i = 0; i < result.size(); i++) {
 		auto &name = names[i];
 		if (name != current_file_path.get()) {
+			if (deletes) {
+				deletes->AddRows(row_ids + run_start, i - run_start);
+			}
+			run_start = i;
 			current_file_path = name;
 			auto key = current_file_path.get().GetString();
 			DUCKDB_LOG(context.context, IcebergLogType,
@@ -155,9 +214,9 @@ static void ScanPositionalDeleteFile(const IcebergDeletePlanningContext &context
 			           bound_entry.entry.data_file.file_path, key);
 			deletes = TryGetOrCreatePositionDeletes(positional_delete_data, bound_entry, key);
 		}
-		if (deletes) {
-			deletes->AddRow(row_ids[i]);
-		}
+	}
+	if (deletes) {
+		deletes->AddRows(row_ids + run_start, result.size() - run_start);
 	}
 }
 
@@ -270,12 +329,49 @@ static vector<MultiFileColumnDefinition> BuildPositionalDeleteSchema() {
 	return schema;
 }
 
-static void ScanParquetDeleteFiles(const IcebergDeletePlanningContext &context,
-                                   const vector<reference<const IcebergDeleteScanEntry>> &scan_entries,
-                                   IcebergManifestEntryContentType content, IcebergDeleteScanResult &scan_result) {
+//! Shared state of one parallel scan over a set of Parquet delete files of the same content type
+struct ParquetDeleteScanState {
+	ParquetDeleteScanState(const IcebergDeletePlanningContext &context,
+	                       const vector<reference<const IcebergDeleteScanEntry>> &scan_entries,
+	                       IcebergManifestEntryContentType content)
+	    : context(context), scan_entries(scan_entries), content(content) {
+	}
+
+	const IcebergDeletePlanningContext &context;
+	const vector<reference<const IcebergDeleteScanEntry>> &scan_entries;
+	IcebergManifestEntryContentType content;
+
+	TableFunction delete_scan_function;
+	unique_ptr<FunctionData> bind_data;
+	unique_ptr<GlobalTableFunctionState> global_state;
+	vector<LogicalType> return_types;
+	vector<column_t> column_ids;
+
+	//! Equality delete files are appended to by every thread reading a row group of the file
+	mutex equality_delete_lock;
+	vector<reference<IcebergEqualityDeleteFile>> equality_delete_files;
+};
+
+//! Results of the scan tasks, merged as every task finishes
+struct DeleteScanResultSink {
+	mutex lock;
+	IcebergDeleteScanResult result;
+
+	void Merge(IcebergDeleteScanResult &&task_result) {
+		lock_guard<mutex> guard(lock);
+		IcebergDeleteFileScanner::MergePositionalDeletes(result.positional_delete_data,
+		                                                 std::move(task_result.positional_delete_data));
+	}
+};
+
+static unique_ptr<ParquetDeleteScanState>
+InitializeParquetDeleteScan(const IcebergDeletePlanningContext &context,
+                            const vector<reference<const IcebergDeleteScanEntry>> &scan_entries,
+                            IcebergManifestEntryContentType content, IcebergDeleteScanResult &scan_result) {
 	if (scan_entries.empty()) {
-		return;
+		return nullptr;
 	}
+	auto state = make_uniq<ParquetDeleteScanState>(context, scan_entries, content);
 	vector<Value> delete_file_paths;
 	vector<OpenFileInfo> delete_file_infos;
 	delete_file_paths.reserve(scan_entries.size());
@@ -298,7 +394,8 @@ static void ScanParquetDeleteFiles(const IcebergDeletePlanningContext &context,
 	}
 
 	auto iceberg_deletes_scan = IcebergFunctions::GetIcebergDeletesScanFunction(context.context);
-	auto delete_scan_function =
+	auto &delete_scan_function = state->delete_scan_function;
+	delete_scan_function =
 	    iceberg_deletes_scan.GetFunctionByArguments(context.context, {LogicalType::LIST(LogicalType::VARCHAR)});
 	vector<MultiFileColumnDefinition> delete_schema = content == IcebergManifestEntryContentType::POSITION_DELETES
 	                                                      ? BuildPositionalDeleteSchema()
@@ -315,65 +412,152 @@ static void ScanParquetDeleteFiles(const IcebergDeletePlanningContext &context,
 
 	TableFunctionBindInput bind_input(children, named_params, input_types, input_names, nullptr, nullptr,
 	                                  delete_scan_function, empty);
-	vector<LogicalType> return_types;
 	vector<Identifier> return_names;
-	auto bind_data = delete_scan_function.bind(context.context, bind_input, return_types, return_names);
-	auto &multi_file_bind_data = bind_data->Cast<MultiFileBindData>();
-
-	DataChunk result;
-	result.Initialize(context.context, return_types, STANDARD_VECTOR_SIZE);
-	ThreadContext thread_context(context.context);
-	ExecutionContext execution_context(context.context, thread_context, nullptr);
-	vector<column_t> column_ids;
-	for (idx_t i = 0; i < return_types.size(); i++) {
-		column_ids.push_back(i);
+	state->bind_data = delete_scan_function.bind(context.context, bind_input, state->return_types, return_names);
+	for (idx_t i = 0; i < state->return_types.size(); i++) {
+		state->column_ids.push_back(i);
 	}
-	TableFunctionInitInput input(bind_data.get(), column_ids, vector<idx_t>(), nullptr);
-	auto global_state = delete_scan_function.init_global(context.context, input);
-	auto local_state = delete_scan_function.init_local(execution_context, input, global_state.get());
-	auto &multi_file_local_state = local_state->Cast<MultiFileLocalState>();
+	TableFunctionInitInput input(state->bind_data.get(), state->column_ids, vector<idx_t>(), nullptr);
+	state->global_state = delete_scan_function.init_global(context.context, input);
 
-	vector<reference<IcebergEqualityDeleteFile>> equality_delete_files;
 	if (content == IcebergManifestEntryContentType::EQUALITY_DELETES) {
 		for (auto &scan_entry_ref : scan_entries) {
 			auto &scan_entry = scan_entry_ref.get();
-			auto equality_delete =
-			    make_shared_ptr<IcebergEqualityDeleteFile>(scan_entry.GetEntry().data_file.equality_ids);
-			equality_delete_files.emplace_back(*equality_delete);
+			auto &manifest_entry = scan_entry.GetEntry();
+			auto equality_delete = make_shared_ptr<IcebergEqualityDeleteFile>(
+			    manifest_entry.data_file.equality_ids, manifest_entry.GetSequenceNumber(scan_entry.manifest.file));
+			state->equality_delete_files.emplace_back(*equality_delete);
 			scan_result.equality_delete_data.push_back({scan_entry.load, std::move(equality_delete)});
 		}
 	}
+	return state;
+}
 
-	while (true) {
-		TableFunctionInput function_input(bind_data.get(), local_state.get(), global_state.get());
-		result.Reset();
-		delete_scan_function.function(context.context, function_input, result);
-		if (result.size() == 0) {
-			break;
-		}
-		result.Flatten();
-		auto file_idx = multi_file_local_state.job.reader->file_list_idx.GetIndex();
-		if (file_idx >= scan_entries.size()) {
-			throw InternalException("Delete batch reader index %llu is out of bounds for %llu files", file_idx,
-			                        scan_entries.size());
-		}
-		auto &scan_entry = scan_entries[file_idx].get();
-		if (content == IcebergManifestEntryContentType::POSITION_DELETES) {
-			ScanPositionalDeleteFile(context, scan_entry, result, scan_result);
-		} else {
-			ScanEqualityDeleteFile(context, scan_entry, equality_delete_files[file_idx].get(), result,
-			                       multi_file_bind_data.reader_bind.schema);
+//! Reads Parquet delete files with its own local state, multiple tasks share the scan of one ParquetDeleteScanState
+class ParquetDeleteScanTask : public BaseExecutorTask {
+public:
+	ParquetDeleteScanTask(TaskExecutor &executor, ParquetDeleteScanState &state, DeleteScanResultSink &sink)
+	    : BaseExecutorTask(executor), state(state), sink(sink) {
+	}
+
+	void ExecuteTask() override {
+		auto &context = state.context;
+		auto &delete_scan_function = state.delete_scan_function;
+		ThreadContext thread_context(context.context);
+		ExecutionContext execution_context(context.context, thread_context, nullptr);
+		TableFunctionInitInput input(state.bind_data.get(), state.column_ids, vector<idx_t>(), nullptr);
+		auto local_state = delete_scan_function.init_local(execution_context, input, state.global_state.get());
+		auto &multi_file_local_state = local_state->Cast<MultiFileLocalState>();
+		auto &multi_file_bind_data = state.bind_data->Cast<MultiFileBindData>();
+
+		IcebergDeleteScanResult task_result;
+		DataChunk result;
+		result.Initialize(context.context, state.return_types, STANDARD_VECTOR_SIZE);
+		while (true) {
+			TableFunctionInput function_input(state.bind_data.get(), local_state.get(), state.global_state.get());
+			result.Reset();
+			delete_scan_function.function(context.context, function_input, result);
+			if (result.size() == 0) {
+				break;
+			}
+			result.Flatten();
+			auto file_idx = multi_file_local_state.job.reader->file_list_idx.GetIndex();
+			if (file_idx >= state.scan_entries.size()) {
+				throw InternalException("Delete batch reader index %llu is out of bounds for %llu files", file_idx,
+				                        state.scan_entries.size());
+			}
+			auto &scan_entry = state.scan_entries[file_idx].get();
+			if (state.content == IcebergManifestEntryContentType::POSITION_DELETES) {
+				ScanPositionalDeleteFile(context, scan_entry, result, task_result);
+			} else {
+				lock_guard<mutex> guard(state.equality_delete_lock);
+				ScanEqualityDeleteFile(context, scan_entry, state.equality_delete_files[file_idx].get(), result,
+				                       multi_file_bind_data.reader_bind.schema);
+			}
 		}
+		sink.Merge(std::move(task_result));
+	}
+
+	string TaskType() const override {
+		return "ParquetDeleteScanTask";
+	}
+
+private:
+	ParquetDeleteScanState &state;
+	DeleteScanResultSink &sink;
+};
+
+//! Reads all requested deletion vectors of one Puffin file
+class PuffinDeleteScanTask : public BaseExecutorTask {
+public:
+	PuffinDeleteScanTask(TaskExecutor &executor, const IcebergDeletePlanningContext &context,
+	                     vector<reference<const IcebergDeleteScanEntry>> scan_entries, DeleteScanResultSink &sink)
+	    : BaseExecutorTask(executor), context(context), scan_entries(std::move(scan_entries)), sink(sink) {
+	}
+
+	void ExecuteTask() override {
+		IcebergDeleteScanResult task_result;
+		ScanPuffinFile(context, std::move(scan_entries), task_result);
+		sink.Merge(std::move(task_result));
+	}
+
+	string TaskType() const override {
+		return "PuffinDeleteScanTask";
+	}
+
+private:
+	const IcebergDeletePlanningContext &context;
+	vector<reference<const IcebergDeleteScanEntry>> scan_entries;
+	DeleteScanResultSink &sink;
+};
+
+static void ScheduleParquetDeleteScan(TaskExecutor &executor, ParquetDeleteScanState &state,
+                                      DeleteScanResultSink &sink) {
+	auto &scheduler = TaskScheduler::GetScheduler(state.context.context);
+	auto num_tasks = MaxValue<idx_t>(MinValue<idx_t>(scheduler.NumberOfThreads(), state.scan_entries.size()), 1);
+	for (idx_t i = 0; i < num_tasks; i++) {
+		executor.ScheduleTask(make_uniq<ParquetDeleteScanTask>(executor, state, sink));
 	}
 }
 
 } // namespace
 
+void IcebergDeleteFileScanner::MergePositionalDeletes(position_delete_map_t &target, position_delete_map_t &&source) {
+	for (auto &entry : source) {
+		auto existing = target.find(entry.first);
+		if (existing == target.end()) {
+			target.emplace(entry.first, std::move(entry.second));
+			continue;
+		}
+
+		auto &target_data = existing->second;
+		auto &source_data = entry.second;
+		if (target_data->type == IcebergDeleteType::DELETION_VECTOR) {
+			if (source_data->type == IcebergDeleteType::DELETION_VECTOR) {
+				throw InvalidConfigurationException(
+				    "Table is corrupt, two or more deletion vectors exist for the same referenced_data_file");
+			}
+			continue;
+		}
+		if (source_data->type == IcebergDeleteType::DELETION_VECTOR) {
+			target_data = std::move(source_data);
+			continue;
+		}
+
+		auto &target_positions = static_cast<IcebergPositionalDeleteData &>(*target_data);
+		auto &source_positions = static_cast<IcebergPositionalDeleteData &>(*source_data);
+		target_positions.Merge(source_positions);
+	}
+}
+
 IcebergDeleteScanResult IcebergDeleteFileScanner::ScanFiles(const IcebergDeletePlanningContext &context,
                                                             const vector<IcebergDeleteScanEntry> &entries) {
-	IcebergDeleteScanResult result;
+	DeleteScanResultSink sink;
 	vector<reference<const IcebergDeleteScanEntry>> positional_delete_entries;
 	vector<reference<const IcebergDeleteScanEntry>> equality_delete_entries;
+	//! Deletion vectors are grouped per Puffin file, so every file is opened once
+	vector<vector<reference<const IcebergDeleteScanEntry>>> puffin_files;
+	unordered_map<string, idx_t> puffin_file_indexes;
 	for (auto &scan_entry : entries) {
 		auto &data_file = scan_entry.GetEntry().data_file;
 		if (StringUtil::CIEquals(data_file.file_format, "parquet")) {
@@ -389,17 +573,42 @@ IcebergDeleteScanResult IcebergDeleteFileScanner::ScanFiles(const IcebergDeleteP
 				                                    data_file.file_path, static_cast<uint8_t>(data_file.content));
 			}
 		} else if (StringUtil::CIEquals(data_file.file_format, "puffin")) {
-			ScanPuffinFile(context, scan_entry, result);
+			auto entry = puffin_file_indexes.emplace(data_file.file_path, puffin_files.size());
+			if (entry.second) {
+				puffin_files.emplace_back();
+			}
+			puffin_files[entry.first->second].emplace_back(scan_entry);
 		} else {
 			throw NotImplementedException(
 			    "File format '%s' not supported for deletes, only supports 'parquet' and 'puffin' currently",
 			    data_file.file_format);
 		}
 	}
-	ScanParquetDeleteFiles(context, positional_delete_entries, IcebergManifestEntryContentType::POSITION_DELETES,
-	                       result);
-	ScanParquetDeleteFiles(context, equality_delete_entries, IcebergManifestEntryContentType::EQUALITY_DELETES, result);
-	return result;
+
+	//! Bind and initialize every scan before scheduling, so no task is running when this throws
+	auto positional_scan = InitializeParquetDeleteScan(
+	    context, positional_delete_entries, IcebergManifestEntryContentType::POSITION_DELETES, sink.result);
+	auto equality_scan = InitializeParquetDeleteScan(
+	    context, equality_delete_entries, IcebergManifestEntryContentType::EQUALITY_DELETES, sink.result);
+
+	TaskExecutor executor(context.context);
+	for (auto &puffin_file : puffin_files) {
+		executor.ScheduleTask(make_uniq<PuffinDeleteScanTask>(executor, context, std::move(puffin_file), sink));
+	}
+	if (positional_scan) {
+		ScheduleParquetDeleteScan(executor, *positional_scan, sink);
+	}
+	if (equality_scan) {
+		ScheduleParquetDeleteScan(executor, *equality_scan, sink);
+	}
+	executor.WorkOnTasks();
+
+	if (equality_scan) {
+		for (auto &equality_delete : equality_scan->equality_delete_files) {
+			equality_delete.get().Finalize();
+		}
+	}
+	return std::move(sink.result);
 }
 
 } // namespace duckdb
@@ -11,7 +11,7 @@ IcebergDeletePlanner::GetDeleteManifestsForDataFile(const IcebergDeletePlanningC
                                                     const BoundIcebergManifestEntry &data_manifest_entry) {
 	vector<idx_t> result;
 	auto &data_manifest = context.data_manifests[data_manifest_entry.manifest_file_idx].entry.file;
-	auto file_pruner = IcebergFilePruner(context.context, context.metadata, context.schema, context.table_filters);
+	auto &file_pruner = context.file_pruner;
 	for (idx_t manifest_idx = 0; manifest_idx < context.delete_manifests.size(); manifest_idx++) {
 		if (!context.delete_manifest_matches[manifest_idx]) {
 			continue;
@@ -34,8 +34,8 @@ bool IcebergDeletePlanner::DeleteEntryMatchesFilters(const IcebergDeletePlanning
 	if (!context.table_filters.HasFilters()) {
 		return true;
 	}
-	return IcebergFilePruner(context.context, context.metadata, context.schema, context.table_filters)
-	    .FileMatchesFilter(context.delete_manifests[delete_manifest_idx].entry.file, delete_manifest_entry);
+	return context.file_pruner.FileMatchesFilter(context.delete_manifests[delete_manifest_idx].entry.file,
+	                                             delete_manifest_entry);
 }
 
 bool IcebergDeletePlanner::DeleteEntryAppliesToDataFile(const IcebergDeletePlanningContext &context,
@@ -51,9 +51,8 @@ bool IcebergDeletePlanner::DeleteEntryAppliesToDataFile(const IcebergDeletePlann
 
 	auto &delete_manifest = context.delete_manifests[delete_manifest_idx].entry.file;
 	auto &data_manifest = context.data_manifests[data_manifest_entry.manifest_file_idx].entry.file;
-	return IcebergFilePruner(context.context, context.metadata, context.schema, context.table_filters)
-	    .DeleteFileMatchesDataFile(delete_manifest, delete_manifest_entry, data_manifest, data_manifest_entry.entry,
-	                               data_partition_values);
+	return context.file_pruner.DeleteFileMatchesDataFile(delete_manifest, delete_manifest_entry, data_manifest,
+	                                                     data_manifest_entry.entry, data_partition_values);
 }
 
 shared_ptr<IcebergDeleteData>
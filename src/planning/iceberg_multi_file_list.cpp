@@ -4,16 +4,20 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/function/partition_stats.hpp"
+#include "duckdb/logging/logger.hpp"
 #include "duckdb/optimizer/filter_combiner.hpp"
 #include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/storage/table/row_group_reorderer.hpp"
 
 #include "catalog/rest/catalog_entry/table/iceberg_table_schema_version.hpp"
+#include "catalog/rest/iceberg_catalog.hpp"
 #include "catalog/rest/transaction/iceberg_transaction.hpp"
 #include "common/iceberg_utils.hpp"
 #include "core/metadata/iceberg_table_metadata.hpp"
+#include "iceberg_logging.hpp"
 #include "planning/deletes/iceberg_delete_file_scanner.hpp"
 #include "planning/iceberg_multi_file_reader.hpp"
+#include "planning/metadata_io/avro/avro_scan.hpp"
 #include "planning/pruning/iceberg_file_pruner.hpp"
 #include "planning/scan_plan/iceberg_scan_plan_provider.hpp"
 
@@ -22,36 +26,8 @@ namespace duckdb {
 namespace {
 
 static void MergeDeleteScanResult(IcebergScanPlanProvider &provider, IcebergDeleteScanResult &&scan_result) {
-	auto &positional_delete_data = provider.PositionalDeleteData();
-	for (auto &entry : scan_result.positional_delete_data) {
-		auto existing = positional_delete_data.find(entry.first);
-		if (existing == positional_delete_data.end()) {
-			positional_delete_data.emplace(entry.first, std::move(entry.second));
-			continue;
-		}
-
-		auto &target = existing->second;
-		auto &source = entry.second;
-		if (target->type == IcebergDeleteType::DELETION_VECTOR) {
-			if (source->type == IcebergDeleteType::DELETION_VECTOR) {
-				throw InvalidConfigurationException(
-				    "Table is corrupt, two or more deletion vectors exist for the same referenced_data_file");
-			}
-			continue;
-		}
-		if (source->type == IcebergDeleteType::DELETION_VECTOR) {
-			target = std::move(source);
-			continue;
-		}
-
-		auto &target_positions = static_cast<IcebergPositionalDeleteData &>(*target);
-		auto &source_positions = static_cast<IcebergPositionalDeleteData &>(*source);
-		for (auto &source_entry : source_positions.entries) {
-			target_positions.entries.push_back(source_entry);
-		}
-		target_positions.invalid_rows.insert(source_positions.invalid_rows.begin(),
-		                                     source_positions.invalid_rows.end());
-	}
+	IcebergDeleteFileScanner::MergePositionalDeletes(provider.PositionalDeleteData(),
+	                                                 std::move(scan_result.positional_delete_data));
 
 	for (auto &entry : scan_result.equality_delete_data) {
 		if (entry.delete_file->equality_values.size() == 0) {
@@ -120,6 +96,13 @@ IcebergScanPlanProvider &IcebergMultiFileList::GetScanPlanProvider() const {
 	return *scan_plan_provider;
 }
 
+const IcebergFilePruner &IcebergMultiFileList::GetFilePruner() const {
+	if (!file_pruner) {
+		file_pruner = make_uniq<IcebergFilePruner>(context, GetMetadata(), GetSchema(), table_filters);
+	}
+	return *file_pruner;
+}
+
 IcebergScanPlanContext IcebergMultiFileList::GetScanPlanContext() const {
 	optional_ptr<const IcebergTransactionData> transaction_data;
 	if (HasTransactionData()) {
@@ -136,6 +119,7 @@ IcebergDeletePlanningContext IcebergMultiFileList::GetDeletePlanningContext() co
 	        GetMetadata(),
 	        GetSchema(),
 	        table_filters,
+	        GetFilePruner(),
 	        data_manifests,
 	        delete_manifests,
 	        delete_manifest_matches,
@@ -148,6 +132,7 @@ optional_ptr<IcebergTableSchemaVersion> IcebergMultiFileList::GetTable() const {
 
 void IcebergMultiFileList::SetTable(IcebergTableSchemaVersion &table) {
 	shared_state->table = table;
+	shared_state->scan_plan_cache = table.catalog.Cast<IcebergCatalog>().scan_plan_cache;
 }
 
 void IcebergMultiFileList::SetOptions(const IcebergOptions &options) {
@@ -318,15 +303,13 @@ FileExpandResult IcebergMultiFileList::GetExpandResult() const {
 }
 
 idx_t IcebergMultiFileList::GetTotalFileCount() const {
-	// FIXME: the 'added_files_count' + the 'existing_files_count'
-	// in the Manifest List should give us this information without scanning the manifest file(s)
 	annotated_lock_guard<annotated_mutex> guard(shared_state->lock);
-
-	idx_t i = data_manifest_entries.size();
-	while (!GetFileInternal(i, guard).path.empty()) {
-		i++;
+	if (data_files_exhausted) {
+		return data_manifest_entries.size();
 	}
-	return data_manifest_entries.size();
+	//! Files that are pruned on their column statistics are still counted, reading the data manifests to find out
+	//! is what this avoids
+	return GetScanEstimate(guard).file_count;
 }
 
 unique_ptr<NodeStatistics> IcebergMultiFileList::GetCardinality(ClientContext &context) const {
@@ -336,31 +319,132 @@ unique_ptr<NodeStatistics> IcebergMultiFileList::GetCardinality(ClientContext &c
 	}
 
 	annotated_lock_guard<annotated_mutex> guard(shared_state->lock);
+	auto &estimate = GetScanEstimate(guard);
+	if (!estimate.exact) {
+		return make_uniq<NodeStatistics>(estimate.row_count);
+	}
+	return make_uniq<NodeStatistics>(estimate.row_count, estimate.row_count);
+}
+
+namespace {
+
+void CountLiveEntries(const vector<IcebergManifestEntry> &entries, idx_t &file_count, idx_t &row_count) {
+	for (auto &entry : entries) {
+		if (entry.status == IcebergManifestEntryStatusType::DELETED) {
+			continue;
+		}
+		file_count++;
+		row_count += NumericCast<idx_t>(entry.data_file.record_count);
+	}
+}
+
+} // namespace
+
+const IcebergScanEstimate &IcebergMultiFileList::GetScanEstimate(annotated_lock_guard<annotated_mutex> &guard) const {
+	if (scan_estimate) {
+		return *scan_estimate;
+	}
 	InitializeView(guard);
 
-	idx_t cardinality = 0;
+	IcebergScanEstimate result;
+	//! The files (of 'result.file_count') whose rows are counted in 'result.row_count'
+	idx_t files_with_rows = 0;
+	vector<reference<const IcebergManifestListEntry>> manifests_without_rows;
+	idx_t files_without_rows = 0;
 	for (idx_t i = 0; i < data_manifests.size(); i++) {
-		auto &manifest = data_manifests[i].entry.file;
 		if (!data_manifest_matches[i]) {
 			continue;
 		}
-		if (!manifest.counts || !manifest.counts->added_rows_count || !manifest.counts->existing_rows_count) {
-			return nullptr;
+		auto &manifest = data_manifests[i].entry;
+		auto &counts = manifest.file.counts;
+		idx_t file_count = 0;
+		idx_t row_count = 0;
+		if (counts && counts->FilesComplete() && counts->RowsComplete()) {
+			file_count = *counts->added_files_count + *counts->existing_files_count;
+			row_count = *counts->added_rows_count + *counts->existing_rows_count;
+		} else if (counts && counts->FilesComplete()) {
+			file_count = *counts->added_files_count + *counts->existing_files_count;
+			auto entry_count = file_count + *counts->deleted_files_count;
+			if (!manifest.HasManifestEntries() || manifest.GetManifestEntries().size() != entry_count) {
+				//! The manifest is not read (yet), only its file count is known
+				result.file_count += file_count;
+				files_without_rows += file_count;
+				manifests_without_rows.push_back(manifest);
+				continue;
+			}
+			file_count = 0;
+			CountLiveEntries(manifest.GetManifestEntries(), file_count, row_count);
+		} else if (manifest.HasManifestEntries()) {
+			//! Manifests without file counts are read eagerly (or planned by the server)
+			CountLiveEntries(manifest.GetManifestEntries(), file_count, row_count);
+		}
+		result.file_count += file_count;
+		result.row_count += row_count;
+		files_with_rows += file_count;
+	}
+	if (files_without_rows) {
+		result.exact = false;
+		double rows_per_file;
+		if (files_with_rows) {
+			rows_per_file = static_cast<double>(result.row_count) / static_cast<double>(files_with_rows);
+		} else {
+			rows_per_file = SampleRowsPerFile(manifests_without_rows);
 		}
-		cardinality += *manifest.counts->added_rows_count;
-		cardinality += *manifest.counts->existing_rows_count;
+		result.row_count += LossyNumericCast<idx_t>(rows_per_file * static_cast<double>(files_without_rows));
 	}
+
+	idx_t deleted_rows = 0;
 	for (idx_t i = 0; i < delete_manifests.size(); i++) {
 		auto &manifest = delete_manifests[i].entry.file;
 		if (!delete_manifest_matches[i]) {
 			continue;
 		}
 		if (!manifest.counts || !manifest.counts->added_rows_count) {
-			return nullptr;
+			result.exact = false;
+			continue;
 		}
-		cardinality -= *manifest.counts->added_rows_count;
-	}
-	return make_uniq<NodeStatistics>(cardinality, cardinality);
+		deleted_rows += *manifest.counts->added_rows_count;
+	}
+	result.row_count -= MinValue(deleted_rows, result.row_count);
+
+	DUCKDB_LOG(context, IcebergLogType, "Iceberg metadata phase=scan_estimate files=%llu rows=%llu exact=%s",
+	           result.file_count, result.row_count, result.exact ? "true" : "false");
+	scan_estimate = make_uniq<IcebergScanEstimate>(result);
+	return *scan_estimate;
+}
+
+double
+IcebergMultiFileList::SampleRowsPerFile(const vector<reference<const IcebergManifestListEntry>> &manifests) const {
+	D_ASSERT(!manifests.empty());
+	auto entry_count = [](const IcebergManifestListEntry &manifest) {
+		auto &counts = *manifest.file.counts;
+		return *counts.added_files_count + *counts.existing_files_count + *counts.deleted_files_count;
+	};
+	auto &smallest = *std::min_element(manifests.begin(), manifests.end(),
+	                                   [&](const reference<const IcebergManifestListEntry> &a,
+	                                       const reference<const IcebergManifestListEntry> &b) {
+		                                   return entry_count(a.get()) < entry_count(b.get());
+	                                   });
+
+	//! Read a copy, the manifest itself is read by the data manifest scan
+	vector<IcebergManifestListEntry> sample;
+	sample.emplace_back(smallest.get().file);
+	auto scan = AvroScan::ScanManifest(GetSnapshot(), sample, options, fs, GetPath(), GetMetadata(), context);
+	auto reader = make_uniq<manifest_file::ManifestReader>(*scan);
+	while (!reader->Finished()) {
+		reader->Read();
+	}
+	idx_t file_count = 0;
+	idx_t row_count = 0;
+	if (sample[0].HasManifestEntries()) {
+		CountLiveEntries(sample[0].GetManifestEntries(), file_count, row_count);
+	}
+	DUCKDB_LOG(context, IcebergLogType, "Iceberg metadata phase=scan_estimate_sample manifest=%s files=%llu rows=%llu",
+	           sample[0].file.manifest_path, file_count, row_count);
+	if (!file_count) {
+		return 0;
+	}
+	return static_cast<double>(row_count) / static_cast<double>(file_count);
 }
 
 BoundIcebergManifestEntry IcebergMultiFileList::GetManifestEntry(idx_t file_id) const {
@@ -383,6 +467,42 @@ IcebergPartition IcebergMultiFileList::GetPartitionForDataFile(const string &fil
 	throw InvalidConfigurationException("Could not find data file '%s' in manifest entries", file_path);
 }
 
+unordered_map<string, IcebergDataFileEntry>
+IcebergMultiFileList::GetEntriesForDataFiles(const unordered_set<string> &file_paths) const {
+	annotated_lock_guard<annotated_mutex> guard(shared_state->lock);
+	unordered_map<string, IcebergDataFileEntry> result;
+	for (auto &bound_entry : data_manifest_entries) {
+		auto &data_file = bound_entry.entry.data_file;
+		auto file_path = data_file.file_path;
+		if (options.allow_moved_paths) {
+			file_path = IcebergUtils::GetFullPath(GetPath(), file_path, fs);
+		}
+		if (!file_paths.count(file_path)) {
+			continue;
+		}
+		auto &manifest_file = GetManifestFileForEntry(bound_entry, IcebergManifestContentType::DATA);
+		auto entry = bound_entry.entry;
+		entry.SetSequenceNumber(entry.GetSequenceNumber(manifest_file));
+		entry.SetFileSequenceNumber(entry.GetFileSequenceNumber(manifest_file));
+		if (bound_entry.HasFirstRowId()) {
+			entry.data_file.SetFirstRowId(bound_entry.GetFirstRowId());
+		}
+		result.emplace(std::move(file_path), IcebergDataFileEntry {std::move(entry), manifest_file});
+	}
+	for (auto &file_path : file_paths) {
+		if (!result.count(file_path)) {
+			throw InvalidConfigurationException("Could not find data file '%s' in manifest entries", file_path);
+		}
+	}
+	return result;
+}
+
+const IcebergManifestFile &IcebergMultiFileList::GetSourceManifest(const BoundIcebergManifestEntry &entry,
+                                                                   IcebergManifestContentType type) const {
+	annotated_lock_guard<annotated_mutex> guard(shared_state->lock);
+	return GetManifestFileForEntry(entry, type);
+}
+
 const IcebergManifestFile &IcebergMultiFileList::GetManifestFileForEntry(const BoundIcebergManifestEntry &entry,
                                                                          IcebergManifestContentType type) const {
 	if (type == IcebergManifestContentType::DATA) {
@@ -445,6 +565,7 @@ IcebergMultiFileList::GetDataFile(idx_t file_id, annotated_lock_guard<annotated_
 	while (file_id >= data_manifest_entries.size()) {
 		if (!TryGetNextBatch(guard)) {
 			FinishScanTasks(guard);
+			data_files_exhausted = true;
 			return nullptr;
 		}
 
@@ -456,6 +577,12 @@ IcebergMultiFileList::GetDataFile(idx_t file_id, annotated_lock_guard<annotated_
 		auto &manifest_file = manifest_list_entry.file;
 		if (!data_manifest_matches[current_batch.manifest_list_entry_idx]) {
 			view_cursor.current_batch_offset = current_batch.end_index;
+		} else if (!view_cursor.current_batch_filtered) {
+			//! Evaluate the filters for the whole batch at once
+			//! Note: the pruner logs a message for every file it prunes
+			GetFilePruner().FilterFiles(manifest_file, manifest_entries, current_batch.start_index,
+			                            current_batch.end_index, view_cursor.current_batch_matches);
+			view_cursor.current_batch_filtered = true;
 		}
 		for (; view_cursor.current_batch_offset < current_batch.end_index && file_id >= data_manifest_entries.size();
 		     view_cursor.current_batch_offset++) {
@@ -471,14 +598,8 @@ IcebergMultiFileList::GetDataFile(idx_t file_id, annotated_lock_guard<annotated_
 
 			//! Bind the entry in order for the manifest list entry to record its row count
 			auto bound_entry = bound_manifest_list_entry.BindEntry(manifest_entry);
-			if (manifest_entry.status == IcebergManifestEntryStatusType::DELETED) {
-				continue;
-			}
-
-			// Check whether current data file is filtered out.
-			if (table_filters.HasFilters() && !IcebergFilePruner(context, GetMetadata(), GetSchema(), table_filters)
-			                                       .FileMatchesFilter(manifest_file, manifest_entry)) {
-				// Note: FileMatches filter will log a message if the file is pruned
+			// Check whether current data file is deleted or filtered out.
+			if (!view_cursor.current_batch_matches[view_cursor.current_batch_offset - current_batch.start_index]) {
 				//! Skip this file
 				continue;
 			}
@@ -565,7 +686,7 @@ void IcebergMultiFileList::InitializeView(annotated_lock_guard<annotated_mutex>
 
 	auto &committed_data_manifests = GetScanPlanProvider().DataManifests();
 	auto &transaction_data_manifests = shared_state->transaction_data_manifests;
-	IcebergFilePruner pruner(context, GetMetadata(), GetSchema(), table_filters);
+	auto &pruner = GetFilePruner();
 	data_manifests.reserve(committed_data_manifests.size() + transaction_data_manifests.size());
 	data_manifest_matches.reserve(committed_data_manifests.size() + transaction_data_manifests.size());
 	for (auto &manifest : committed_data_manifests) {
@@ -724,7 +845,7 @@ IcebergDeletePlan IcebergMultiFileList::ProcessDeletes(const BoundIcebergManifes
 			load->error.Throw();
 		}
 		if (load->equality_delete) {
-			result.equality_deletes.emplace_back(*load->equality_delete);
+			result.equality_deletes.push_back(load->equality_delete);
 		}
 	}
 
@@ -9,11 +9,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
-#include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
-#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 
 #include "common/iceberg_utils.hpp"
 #include "iceberg_logging.hpp"
@@ -182,12 +180,12 @@ IcebergEqualityDeleteReadColumn IcebergMultiFileReader::AddEqualityDeleteColumn(
 }
 
 vector<IcebergEqualityDeleteReadColumn> IcebergMultiFileReader::AddEqualityDeleteColumns(
-    const IcebergTableMetadata &metadata, const vector<reference<const IcebergEqualityDeleteFile>> &delete_files,
+    const IcebergTableMetadata &metadata, const vector<shared_ptr<const IcebergEqualityDeleteFile>> &delete_files,
     vector<MultiFileColumnDefinition> &scan_columns, vector<ColumnIndex> &scan_column_ids,
     MultiFileReaderData &reader_data, ClientContext &context) {
 	set<int32_t> required_field_ids;
-	for (auto &delete_file_ref : delete_files) {
-		for (auto field_id : delete_file_ref.get().equality_ids) {
+	for (auto &delete_file : delete_files) {
+		for (auto field_id : delete_file->equality_ids) {
 			required_field_ids.insert(field_id);
 		}
 	}
@@ -417,8 +415,9 @@ ReaderInitializeType IcebergMultiFileReader::InitializeReader(MultiFileReaderDat
 	ApplyPartitionConstants(manifest_file, bound_manifest_entry, metadata, reader_data, scan_columns, scan_column_ids,
 	                        context);
 
-	equality_delete_state->expression =
-	    CreateEqualityDeleteExpression(delete_plan.equality_deletes, local_columns, *equality_delete_state);
+	auto data_sequence_number = bound_manifest_entry.entry.GetSequenceNumber(manifest_file);
+	CreateEqualityDeleteProbes(delete_plan.equality_deletes, local_columns, data_sequence_number,
+	                           *equality_delete_state, context);
 	iceberg_state.CacheEqualityDeleteReadState(file_id, std::move(equality_delete_state));
 
 	return CreateMapping(context, reader_data, scan_columns, scan_column_ids, table_filters, gstate.file_list,
@@ -433,93 +432,95 @@ void IcebergMultiFileReader::FinalizeBind(MultiFileReaderData &reader_data, cons
 	throw InternalException("IcebergMultiFileReader::FinalizeBind is unreachable");
 }
 
-unique_ptr<Expression> IcebergMultiFileReader::CreateEqualityDeleteExpression(
-    const vector<reference<const IcebergEqualityDeleteFile>> &delete_files,
-    const vector<MultiFileColumnDefinition> &local_columns, const IcebergEqualityDeleteReadState &read_state) {
+void IcebergMultiFileReader::CreateEqualityDeleteProbes(
+    const vector<shared_ptr<const IcebergEqualityDeleteFile>> &delete_files,
+    const vector<MultiFileColumnDefinition> &local_columns, sequence_number_t data_sequence_number,
+    IcebergEqualityDeleteReadState &read_state, ClientContext &context) {
 	if (delete_files.empty()) {
-		return nullptr;
+		return;
 	}
 
 	//! Map every field id, including nested fields, to its path in 'local_columns'.
 	auto id_to_local_column = CreateFieldIdMap(local_columns);
 
-	//! Create a big CONJUNCTION_AND of all the rows, illustrative example:
-	//! WHERE
-	//!	(col1 != 'A' OR col2 != 'B') AND
-	//!	(col1 != 'C' OR col2 != 'D') AND
-	//!	(col1 != 'X' OR col2 != 'Y') AND
-	//!	(col1 != 'Z' OR col2 != 'W')
-
-	vector<unique_ptr<Expression>> rows;
-	for (auto &delete_file_ref : delete_files) {
-		auto &delete_file = delete_file_ref.get();
-		auto &equality_values = delete_file.equality_values;
+	//! Every delete file is probed with a hash lookup on its equality columns, a row is removed
+	//! when all of its equality columns are NOT DISTINCT FROM those of a deleted row, illustrative example:
+	//! WHERE (col1, col2) NOT IN {('A', 'B'), ('C', 'D'), ('X', 'Y'), ('Z', 'W')}
+	for (auto &delete_file : delete_files) {
+		auto &equality_values = delete_file->equality_values;
 		if (equality_values.size() == 0) {
 			continue;
 		}
-		auto &equality_ids = delete_file.equality_ids;
+		if (delete_file->sequence_number <= data_sequence_number) {
+			//! Equality deletes only apply to data files written before them
+			continue;
+		}
+		auto &equality_ids = delete_file->equality_ids;
 		if (equality_values.ColumnCount() != equality_ids.size()) {
 			throw InvalidConfigurationException("Equality delete file contains an unexpected number of columns");
 		}
-		auto row_count = equality_values.size();
-		for (idx_t row_index = 0; row_index < row_count; row_index++) {
-			vector<unique_ptr<Expression>> equalities;
-			for (idx_t column_index = 0; column_index < equality_ids.size(); column_index++) {
-				auto field_id = equality_ids[column_index];
-				auto constant = equality_values.GetValue(column_index, row_index);
-
-				if (!id_to_local_column.count(field_id)) {
-					//! A field absent from the data file is NULL for equality-delete matching,
-					//! regardless of its Iceberg initial default.
-					equalities.push_back(make_uniq<BoundConstantExpression>(Value::BOOLEAN(!constant.IsNull())));
-					continue;
-				}
 
-				auto state_entry = read_state.field_indexes.find(field_id);
-				if (state_entry == read_state.field_indexes.end()) {
-					throw InternalException("Missing private scan column for equality-delete field id %d", field_id);
-				}
-				auto equality_column_index = state_entry->second;
-				auto &column = read_state.columns[equality_column_index];
-				auto bound_ref = make_uniq<BoundReferenceExpression>(column.type, equality_column_index);
-				if (!constant.IsNull()) {
-					equalities.push_back(
-					    BoundComparisonExpression::Create(ExpressionType::COMPARE_DISTINCT_FROM, std::move(bound_ref),
-					                                      make_uniq<BoundConstantExpression>(constant)));
-				} else {
-					auto is_not_null =
-					    make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_IS_NOT_NULL, LogicalType::BOOLEAN);
-					is_not_null->GetChildrenMutable().push_back(std::move(bound_ref));
-					equalities.push_back(std::move(is_not_null));
-				}
+		IcebergEqualityDeleteProbe probe;
+		bool requires_cast = false;
+		for (idx_t column_index = 0; column_index < equality_ids.size(); column_index++) {
+			auto field_id = equality_ids[column_index];
+			auto &delete_type = equality_values.data[column_index].GetType();
+			if (!id_to_local_column.count(field_id)) {
+				//! A field absent from the data file is NULL for equality-delete matching,
+				//! regardless of its Iceberg initial default.
+				probe.key_columns.push_back(DConstants::INVALID_INDEX);
+				probe.key_types.push_back(delete_type);
+				continue;
 			}
 
-			unique_ptr<Expression> filter;
-			D_ASSERT(!equalities.empty());
-			if (equalities.size() > 1) {
-				auto conjunction_or = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_OR);
-				conjunction_or->GetChildrenMutable() = std::move(equalities);
-				filter = std::move(conjunction_or);
-			} else {
-				filter = std::move(equalities[0]);
+			auto state_entry = read_state.field_indexes.find(field_id);
+			if (state_entry == read_state.field_indexes.end()) {
+				throw InternalException("Missing private scan column for equality-delete field id %d", field_id);
 			}
-			rows.push_back(std::move(filter));
+			auto equality_column_index = state_entry->second;
+			auto &column = read_state.columns[equality_column_index];
+			probe.key_columns.push_back(equality_column_index);
+			probe.key_types.push_back(column.type);
+			requires_cast |= column.type != delete_type;
+		}
+
+		if (requires_cast) {
+			//! The column type was promoted after the delete file was written, match on the promoted type
+			probe.delete_file = delete_file->CastTo(context, probe.key_types);
+		} else {
+			probe.delete_file = delete_file;
 		}
+		read_state.probes.push_back(std::move(probe));
 	}
-	if (rows.empty()) {
-		return nullptr;
+}
+
+idx_t IcebergMultiFileReader::FilterEqualityDeletes(const IcebergEqualityDeleteReadState &read_state,
+                                                    DataChunk &values, SelectionVector &result) {
+	idx_t count = values.size();
+	result.Initialize(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < count; i++) {
+		result.set_index(i, i);
 	}
 
-	unique_ptr<Expression> equality_delete_filter;
-	D_ASSERT(!rows.empty());
-	if (rows.size() == 1) {
-		equality_delete_filter = std::move(rows[0]);
-	} else {
-		auto conjunction_and = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
-		conjunction_and->GetChildrenMutable() = std::move(rows);
-		equality_delete_filter = std::move(conjunction_and);
+	for (auto &probe : read_state.probes) {
+		if (count == 0) {
+			break;
+		}
+		DataChunk keys;
+		keys.InitializeEmpty(probe.key_types);
+		for (idx_t key_index = 0; key_index < probe.key_columns.size(); key_index++) {
+			auto column_index = probe.key_columns[key_index];
+			if (column_index == DConstants::INVALID_INDEX) {
+				keys.data[key_index].Reference(Value(probe.key_types[key_index]));
+			} else {
+				keys.data[key_index].Reference(values.data[column_index]);
+			}
+		}
+		keys.SetCardinality(values.size());
+		//! Filtering in-place is safe, rows are only ever moved to an earlier position
+		count = probe.delete_file->Filter(keys, result, count, result);
 	}
-	return equality_delete_filter;
+	return count;
 }
 
 void IcebergMultiFileReader::FinalizeChunk(ClientContext &context, const MultiFileBindData &bind_data,
@@ -536,8 +537,7 @@ void IcebergMultiFileReader::FinalizeChunk(ClientContext &context, const MultiFi
 
 	auto file_id = reader.file_list_idx.GetIndex();
 	auto &equality_delete_state = iceberg_state.GetEqualityDeleteReadState(file_id);
-	auto equality_delete_expression = equality_delete_state.expression.get();
-	if (equality_delete_expression) {
+	if (!equality_delete_state.probes.empty()) {
 		ExpressionExecutor equality_delete_executor(context);
 		for (auto &column : equality_delete_state.columns) {
 			D_ASSERT(column.expression_index < reader_data.expressions.size());
@@ -547,10 +547,11 @@ void IcebergMultiFileReader::FinalizeChunk(ClientContext &context, const MultiFi
 		equality_delete_chunk.Initialize(context, equality_delete_state.types);
 		equality_delete_executor.Execute(input_chunk, equality_delete_chunk);
 
-		ExpressionExecutor filter_executor(context, *equality_delete_expression);
-		SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
-		idx_t count = filter_executor.SelectExpression(equality_delete_chunk, sel_vec);
-		output_chunk.Slice(sel_vec, count);
+		SelectionVector sel_vec;
+		idx_t count = FilterEqualityDeletes(equality_delete_state, equality_delete_chunk, sel_vec);
+		if (count < equality_delete_chunk.size()) {
+			output_chunk.Slice(sel_vec, count);
+		}
 	}
 }
 
@@ -0,0 +1,613 @@
+#include "planning/metadata_io/cache/iceberg_manifest_cache.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/logging/logger.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "iceberg_logging.hpp"
+#include "iceberg_options.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+namespace {
+
+//! "ICMC", followed by the layout version: bump the version whenever the layout below changes, files written with
+//! another version are treated as a miss
+static constexpr uint32_t MANIFEST_CACHE_MAGIC = 0x434D4349;
+static constexpr uint32_t MANIFEST_CACHE_VERSION = 1;
+static constexpr const char *MANIFEST_CACHE_FILE_EXTENSION = ".icmc";
+
+void WriteString(MemoryStream &stream, const char *data, idx_t size) {
+	stream.Write<uint32_t>(NumericCast<uint32_t>(size));
+	stream.WriteData(const_data_ptr_cast(data), size);
+}
+
+void WriteString(MemoryStream &stream, const string &value) {
+	WriteString(stream, value.data(), value.size());
+}
+
+//! Read a length prefix, and check that the rest of the stream can hold that many elements of at least
+//! 'min_element_size' bytes: a corrupt length then fails before anything is allocated for it
+template <class T>
+idx_t ReadLength(MemoryStream &stream, idx_t min_element_size) {
+	idx_t length = stream.Read<T>();
+	auto remaining = stream.GetCapacity() - stream.GetPosition();
+	if (length > remaining / min_element_size) {
+		throw SerializationException("Iceberg manifest cache: length %llu exceeds the %llu remaining bytes", length,
+		                             remaining);
+	}
+	return length;
+}
+
+string ReadString(MemoryStream &stream) {
+	auto size = ReadLength<uint32_t>(stream, 1);
+	string result(size, '\0');
+	stream.ReadData(data_ptr_cast(&result[0]), size);
+	return result;
+}
+
+template <class T>
+void WriteOptional(MemoryStream &stream, const optional<T> &value) {
+	stream.Write<bool>(value.has_value());
+	if (value) {
+		stream.Write<T>(*value);
+	}
+}
+
+template <class T>
+optional<T> ReadOptional(MemoryStream &stream) {
+	if (!stream.Read<bool>()) {
+		return std::nullopt;
+	}
+	return stream.Read<T>();
+}
+
+template <class T>
+void WriteList(MemoryStream &stream, const vector<T> &values) {
+	stream.Write<uint32_t>(NumericCast<uint32_t>(values.size()));
+	for (auto &value : values) {
+		stream.Write<T>(value);
+	}
+}
+
+template <class T>
+vector<T> ReadList(MemoryStream &stream) {
+	auto count = ReadLength<uint32_t>(stream, sizeof(T));
+	vector<T> result;
+	result.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		result.push_back(stream.Read<T>());
+	}
+	return result;
+}
+
+//! Bounds of field summaries are BLOB Values, NULL when absent
+void WriteBlobValue(MemoryStream &stream, const Value &value) {
+	stream.Write<bool>(!value.IsNull());
+	if (!value.IsNull()) {
+		auto &blob = StringValue::Get(value);
+		WriteString(stream, blob);
+	}
+}
+
+Value ReadBlobValue(MemoryStream &stream) {
+	if (!stream.Read<bool>()) {
+		return Value(LogicalType::BLOB);
+	}
+	auto blob = ReadString(stream);
+	return Value::BLOB(const_data_ptr_cast(blob.data()), blob.size());
+}
+
+//! Partition values can have any primitive type, these go through the regular Value serialization
+void WriteValue(MemoryStream &stream, const Value &value) {
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	value.Serialize(serializer);
+	serializer.End();
+}
+
+Value ReadValue(MemoryStream &stream) {
+	BinaryDeserializer deserializer(stream);
+	deserializer.Begin();
+	auto result = Value::Deserialize(deserializer);
+	deserializer.End();
+	return result;
+}
+
+void WriteManifestFile(MemoryStream &stream, const IcebergManifestFile &file) {
+	WriteString(stream, file.manifest_path);
+	stream.Write<int64_t>(file.manifest_length);
+	stream.Write<int32_t>(file.partition_spec_id);
+	WriteOptional(stream, file.first_row_id);
+	stream.Write<uint8_t>(static_cast<uint8_t>(file.content));
+	WriteOptional(stream, file.sequence_number);
+	WriteOptional(stream, file.min_sequence_number);
+	WriteOptional(stream, file.added_snapshot_id);
+	stream.Write<bool>(file.counts.has_value());
+	if (file.counts) {
+		auto &counts = *file.counts;
+		WriteOptional(stream, counts.added_files_count);
+		WriteOptional(stream, counts.existing_files_count);
+		WriteOptional(stream, counts.deleted_files_count);
+		WriteOptional(stream, counts.added_rows_count);
+		WriteOptional(stream, counts.existing_rows_count);
+		WriteOptional(stream, counts.deleted_rows_count);
+	}
+	stream.Write<bool>(file.partitions.has_partitions);
+	auto &field_summaries = file.partitions.field_summary;
+	stream.Write<uint32_t>(NumericCast<uint32_t>(field_summaries.size()));
+	for (auto &field_summary : field_summaries) {
+		stream.Write<bool>(field_summary.contains_null);
+		stream.Write<bool>(field_summary.contains_nan);
+		WriteBlobValue(stream, field_summary.lower_bound);
+		WriteBlobValue(stream, field_summary.upper_bound);
+	}
+}
+
+IcebergManifestFile ReadManifestFile(MemoryStream &stream) {
+	IcebergManifestFile file(ReadString(stream));
+	file.manifest_length = stream.Read<int64_t>();
+	file.partition_spec_id = stream.Read<int32_t>();
+	file.first_row_id = ReadOptional<sequence_number_t>(stream);
+	file.content = static_cast<IcebergManifestContentType>(stream.Read<uint8_t>());
+	file.sequence_number = ReadOptional<sequence_number_t>(stream);
+	file.min_sequence_number = ReadOptional<sequence_number_t>(stream);
+	file.added_snapshot_id = ReadOptional<int64_t>(stream);
+	if (stream.Read<bool>()) {
+		IcebergManifestCounts counts;
+		counts.added_files_count = ReadOptional<idx_t>(stream);
+		counts.existing_files_count = ReadOptional<idx_t>(stream);
+		counts.deleted_files_count = ReadOptional<idx_t>(stream);
+		counts.added_rows_count = ReadOptional<idx_t>(stream);
+		counts.existing_rows_count = ReadOptional<idx_t>(stream);
+		counts.deleted_rows_count = ReadOptional<idx_t>(stream);
+		file.counts = std::move(counts);
+	}
+	file.partitions.has_partitions = stream.Read<bool>();
+	//! contains_null, contains_nan and the presence flags of both bounds
+	auto field_summary_count = ReadLength<uint32_t>(stream, 4 * sizeof(bool));
+	for (idx_t i = 0; i < field_summary_count; i++) {
+		FieldSummary field_summary;
+		field_summary.contains_null = stream.Read<bool>();
+		field_summary.contains_nan = stream.Read<bool>();
+		field_summary.lower_bound = ReadBlobValue(stream);
+		field_summary.upper_bound = ReadBlobValue(stream);
+		file.partitions.field_summary.push_back(std::move(field_summary));
+	}
+	return file;
+}
+
+static constexpr uint8_t COLUMN_STAT_TYPE_COUNT = static_cast<uint8_t>(IcebergColumnStatType::UPPER_BOUND) + 1;
+
+bool IsBoundStat(IcebergColumnStatType type) {
+	return type == IcebergColumnStatType::LOWER_BOUND || type == IcebergColumnStatType::UPPER_BOUND;
+}
+
+void WriteColumnStats(MemoryStream &stream, const IcebergColumnStats &column_stats) {
+	stream.Write<uint32_t>(NumericCast<uint32_t>(column_stats.FieldCount()));
+	for (idx_t row_idx = 0; row_idx < column_stats.FieldCount(); row_idx++) {
+		stream.Write<int32_t>(column_stats.RowFieldId(row_idx));
+		uint8_t flags = 0;
+		for (uint8_t type_idx = 0; type_idx < COLUMN_STAT_TYPE_COUNT; type_idx++) {
+			if (column_stats.RowHasStat(row_idx, static_cast<IcebergColumnStatType>(type_idx))) {
+				flags |= static_cast<uint8_t>(1 << type_idx);
+			}
+		}
+		stream.Write<uint8_t>(flags);
+		for (uint8_t type_idx = 0; type_idx < COLUMN_STAT_TYPE_COUNT; type_idx++) {
+			auto type = static_cast<IcebergColumnStatType>(type_idx);
+			if (!column_stats.RowHasStat(row_idx, type)) {
+				continue;
+			}
+			if (IsBoundStat(type)) {
+				auto &bound = column_stats.RowBound(row_idx, type);
+				WriteString(stream, bound.GetData(), bound.GetSize());
+			} else {
+				stream.Write<int64_t>(column_stats.RowStatCount(row_idx, type));
+			}
+		}
+	}
+}
+
+//! All data files of a manifest share a single batch, like they do when the manifest is decoded from Avro
+IcebergColumnStats ReadColumnStats(MemoryStream &stream, const shared_ptr<IcebergColumnStatsBatch> &batch) {
+	auto offset = batch->Size();
+	//! The field id and the flags of the stats that are present
+	auto field_count = ReadLength<uint32_t>(stream, sizeof(int32_t) + sizeof(uint8_t));
+	for (idx_t i = 0; i < field_count; i++) {
+		auto row_idx = batch->AppendRow(stream.Read<int32_t>());
+		auto flags = stream.Read<uint8_t>();
+		for (uint8_t type_idx = 0; type_idx < COLUMN_STAT_TYPE_COUNT; type_idx++) {
+			if (!(flags & (1 << type_idx))) {
+				continue;
+			}
+			auto type = static_cast<IcebergColumnStatType>(type_idx);
+			if (IsBoundStat(type)) {
+				auto bound = ReadString(stream);
+				batch->SetBound(row_idx, type, bound.data(), bound.size());
+			} else {
+				batch->SetCount(row_idx, type, stream.Read<int64_t>());
+			}
+		}
+	}
+	return IcebergColumnStats(batch, offset, field_count);
+}
+
+void WriteManifestEntry(MemoryStream &stream, const IcebergManifestEntry &entry) {
+	stream.Write<uint8_t>(static_cast<uint8_t>(entry.status));
+	WriteOptional(stream, entry.HasSnapshotId() ? optional<int64_t>(entry.GetSnapshotId()) : optional<int64_t>());
+	WriteOptional(stream, entry.ExplicitSequenceNumber());
+	WriteOptional(stream, entry.ExplicitFileSequenceNumber());
+
+	auto &data_file = entry.data_file;
+	stream.Write<uint8_t>(static_cast<uint8_t>(data_file.content));
+	WriteString(stream, data_file.file_path);
+	WriteString(stream, data_file.file_format);
+	stream.Write<uint32_t>(NumericCast<uint32_t>(data_file.partition_info.size()));
+	for (auto &partition : data_file.partition_info) {
+		stream.Write<uint64_t>(partition.field_id);
+		WriteValue(stream, partition.value);
+	}
+	stream.Write<int64_t>(data_file.record_count);
+	stream.Write<int64_t>(data_file.file_size_in_bytes);
+	WriteColumnStats(stream, data_file.column_stats);
+	WriteList(stream, data_file.equality_ids);
+	WriteList(stream, data_file.split_offsets);
+	WriteOptional(stream, data_file.sort_order_id);
+	stream.Write<bool>(data_file.referenced_data_file.has_value());
+	if (data_file.referenced_data_file) {
+		WriteString(stream, *data_file.referenced_data_file);
+	}
+	WriteOptional(stream, data_file.content_offset);
+	WriteOptional(stream, data_file.content_size_in_bytes);
+	WriteOptional(stream, data_file.HasFirstRowId() ? optional<int64_t>(data_file.GetFirstRowId())
+	                                                : optional<int64_t>());
+}
+
+IcebergManifestEntry ReadManifestEntry(MemoryStream &stream, const shared_ptr<IcebergColumnStatsBatch> &batch) {
+	IcebergManifestEntry entry;
+	entry.status = static_cast<IcebergManifestEntryStatusType>(stream.Read<uint8_t>());
+	entry.SetSnapshotId(ReadOptional<int64_t>(stream));
+	entry.SetSequenceNumber(ReadOptional<sequence_number_t>(stream));
+	entry.SetFileSequenceNumber(ReadOptional<sequence_number_t>(stream));
+
+	auto &data_file = entry.data_file;
+	data_file.content = static_cast<IcebergManifestEntryContentType>(stream.Read<uint8_t>());
+	data_file.file_path = ReadString(stream);
+	data_file.file_format = ReadString(stream);
+	auto partition_count = ReadLength<uint32_t>(stream, sizeof(uint64_t));
+	data_file.partition_info.reserve(partition_count);
+	for (idx_t i = 0; i < partition_count; i++) {
+		IcebergPartitionInfo partition;
+		partition.field_id = stream.Read<uint64_t>();
+		partition.value = ReadValue(stream);
+		data_file.partition_info.push_back(std::move(partition));
+	}
+	data_file.record_count = stream.Read<int64_t>();
+	data_file.file_size_in_bytes = stream.Read<int64_t>();
+	data_file.column_stats = ReadColumnStats(stream, batch);
+	data_file.equality_ids = ReadList<int32_t>(stream);
+	data_file.split_offsets = ReadList<int64_t>(stream);
+	data_file.sort_order_id = ReadOptional<int32_t>(stream);
+	if (stream.Read<bool>()) {
+		data_file.referenced_data_file = ReadString(stream);
+	}
+	data_file.content_offset = ReadOptional<int64_t>(stream);
+	data_file.content_size_in_bytes = ReadOptional<int64_t>(stream);
+	data_file.SetFirstRowId(ReadOptional<int64_t>(stream));
+	return entry;
+}
+
+//! Every cache file starts with the magic, the layout version and the full key, so a hash collision is a miss
+void WriteHeader(MemoryStream &stream, const string &key) {
+	stream.Write<uint32_t>(MANIFEST_CACHE_MAGIC);
+	stream.Write<uint32_t>(MANIFEST_CACHE_VERSION);
+	WriteString(stream, key);
+}
+
+bool ReadHeader(MemoryStream &stream, const string &key) {
+	if (stream.Read<uint32_t>() != MANIFEST_CACHE_MAGIC || stream.Read<uint32_t>() != MANIFEST_CACHE_VERSION) {
+		return false;
+	}
+	return ReadString(stream) == key;
+}
+
+string ManifestListKey(const string &path, idx_t iceberg_version) {
+	return StringUtil::Format("manifest_list:v%llu:%s", iceberg_version, path);
+}
+
+string ManifestKey(const IcebergManifestFile &manifest, idx_t iceberg_version) {
+	return StringUtil::Format("manifest:v%llu:%lld:%s", iceberg_version, manifest.manifest_length,
+	                          manifest.manifest_path);
+}
+
+string StreamToString(MemoryStream &stream) {
+	return string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+}
+
+} // namespace
+
+//! Bookkeeping of a cache directory, shared by every cache in the process that uses the directory
+struct IcebergManifestCacheDirectory {
+	mutex lock;
+	//! Whether the directory has been swept once, the total size is not known before that
+	bool initialized = false;
+	//! Running total of the cached files: grown by every write, recomputed from the directory by every sweep
+	idx_t total_size = 0;
+	//! Last hit of a cached file, by path. The modification time of a file is only its last write, so eviction takes
+	//! the later of the two to be least recently used instead of first in, first out
+	unordered_map<string, timestamp_t> last_access;
+
+	static shared_ptr<IcebergManifestCacheDirectory> Get(const string &directory) {
+		static mutex directories_lock;
+		static unordered_map<string, shared_ptr<IcebergManifestCacheDirectory>> directories;
+		lock_guard<mutex> guard(directories_lock);
+		auto &result = directories[directory];
+		if (!result) {
+			result = make_shared_ptr<IcebergManifestCacheDirectory>();
+		}
+		return result;
+	}
+};
+
+IcebergManifestCache::IcebergManifestCache(ClientContext &context, string directory_p, idx_t max_size)
+    : context(context), fs(FileSystem::GetFileSystem(context)), directory(std::move(directory_p)),
+      max_size(max_size), state(IcebergManifestCacheDirectory::Get(directory)) {
+}
+
+unique_ptr<IcebergManifestCache> IcebergManifestCache::TryCreate(ClientContext &context) {
+	Value directory;
+	if (!context.TryGetCurrentSetting(MANIFEST_CACHE_DIRECTORY_CONFIG_VARIABLE, directory) || directory.IsNull()) {
+		return nullptr;
+	}
+	auto directory_str = directory.ToString();
+	if (directory_str.empty()) {
+		return nullptr;
+	}
+	idx_t max_size = DEFAULT_MANIFEST_CACHE_MAX_SIZE;
+	Value max_size_value;
+	if (context.TryGetCurrentSetting(MANIFEST_CACHE_MAX_SIZE_CONFIG_VARIABLE, max_size_value) &&
+	    !max_size_value.IsNull()) {
+		max_size = max_size_value.GetValue<uint64_t>();
+	}
+	return make_uniq<IcebergManifestCache>(context, std::move(directory_str), max_size);
+}
+
+string IcebergManifestCache::GetCachePath(const string &key) const {
+	auto hash = Hash(key.c_str(), key.size());
+	return fs.JoinPath(directory, StringUtil::Format("%016llx%s", hash, MANIFEST_CACHE_FILE_EXTENSION));
+}
+
+bool IcebergManifestCache::TryRead(const string &key, string &result) {
+	auto path = GetCachePath(key);
+	try {
+		if (!fs.FileExists(path)) {
+			return false;
+		}
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		auto size = handle->GetFileSize();
+		result.resize(size);
+		handle->Read(&result[0], size, 0);
+		lock_guard<mutex> guard(state->lock);
+		state->last_access[path] = Timestamp::GetCurrentTimestamp();
+		return true;
+	} catch (std::exception &ex) {
+		//! The cache is best effort, a cache file that can't be read is a miss
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg manifest cache: failed to read '%s': %s", path, error.Message());
+		return false;
+	}
+}
+
+void IcebergManifestCache::Write(const string &key, const string &payload) {
+	auto path = GetCachePath(key);
+	//! Write to a temporary file first, so concurrent readers never see a partially written cache file
+	auto temp_path = path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	try {
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectoriesRecursive(directory);
+		}
+		auto handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		handle->Write(const_cast<char *>(payload.data()), payload.size());
+		handle->Sync();
+		handle->Close();
+		fs.MoveFile(temp_path, path);
+		//! Overwriting an existing file counts it twice, which at worst makes the next sweep come early
+		lock_guard<mutex> guard(state->lock);
+		state->total_size += payload.size();
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg manifest cache: failed to write '%s': %s", path,
+		           error.Message());
+		try {
+			fs.TryRemoveFile(temp_path);
+		} catch (...) { // LCOV_EXCL_START
+		} // LCOV_EXCL_STOP
+	}
+}
+
+void IcebergManifestCache::EnforceSizeLimit() {
+	struct CacheFile {
+		string path;
+		idx_t size;
+		timestamp_t last_used;
+	};
+	lock_guard<mutex> guard(state->lock);
+	if (state->initialized && state->total_size <= max_size) {
+		return;
+	}
+	vector<CacheFile> cache_files;
+	idx_t total_size = 0;
+	try {
+		fs.ListFiles(directory, [&](const string &name, bool is_directory) {
+			if (is_directory || !StringUtil::EndsWith(name, MANIFEST_CACHE_FILE_EXTENSION)) {
+				return;
+			}
+			auto path = fs.JoinPath(directory, name);
+			try {
+				auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+				CacheFile cache_file {path, NumericCast<idx_t>(handle->GetFileSize()),
+				                      fs.GetLastModifiedTime(*handle)};
+				auto entry = state->last_access.find(path);
+				if (entry != state->last_access.end() && entry->second > cache_file.last_used) {
+					cache_file.last_used = entry->second;
+				}
+				total_size += cache_file.size;
+				cache_files.push_back(std::move(cache_file));
+			} catch (std::exception &) {
+				//! Removed by a concurrent eviction
+			}
+		});
+		state->initialized = true;
+		state->total_size = total_size;
+		if (total_size <= max_size) {
+			return;
+		}
+		std::sort(cache_files.begin(), cache_files.end(),
+		          [](const CacheFile &a, const CacheFile &b) { return a.last_used < b.last_used; });
+		idx_t evicted_count = 0;
+		for (auto &cache_file : cache_files) {
+			if (total_size <= max_size) {
+				break;
+			}
+			fs.TryRemoveFile(cache_file.path);
+			state->last_access.erase(cache_file.path);
+			total_size -= cache_file.size;
+			evicted_count++;
+		}
+		state->total_size = total_size;
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg manifest cache: evicted %llu files, %llu bytes remain",
+		           evicted_count, total_size);
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg manifest cache: failed to evict from '%s': %s", directory,
+		           error.Message());
+	}
+}
+
+bool IcebergManifestCache::TryLoadManifestList(const string &path, idx_t iceberg_version,
+                                               vector<IcebergManifestListEntry> &result) {
+	auto key = ManifestListKey(path, iceberg_version);
+	string buffer;
+	if (!TryRead(key, buffer)) {
+		return false;
+	}
+	try {
+		MemoryStream stream(data_ptr_cast(&buffer[0]), buffer.size());
+		if (!ReadHeader(stream, key)) {
+			return false;
+		}
+		vector<IcebergManifestListEntry> entries;
+		auto entry_count = ReadLength<uint64_t>(stream, 1);
+		entries.reserve(entry_count);
+		for (idx_t i = 0; i < entry_count; i++) {
+			entries.emplace_back(ReadManifestFile(stream));
+		}
+		result = std::move(entries);
+		return true;
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg manifest cache: ignoring corrupt entry for '%s': %s", path,
+		           error.Message());
+		return false;
+	}
+}
+
+void IcebergManifestCache::StoreManifestList(const string &path, idx_t iceberg_version,
+                                             const vector<IcebergManifestListEntry> &entries) {
+	auto key = ManifestListKey(path, iceberg_version);
+	MemoryStream stream;
+	WriteHeader(stream, key);
+	stream.Write<uint64_t>(entries.size());
+	for (auto &entry : entries) {
+		WriteManifestFile(stream, entry.file);
+	}
+	Write(key, StreamToString(stream));
+	EnforceSizeLimit();
+}
+
+bool IcebergManifestCache::TryLoadManifest(IcebergManifestListEntry &manifest, idx_t iceberg_version) {
+	auto key = ManifestKey(manifest.file, iceberg_version);
+	string buffer;
+	if (!TryRead(key, buffer)) {
+		return false;
+	}
+	try {
+		MemoryStream stream(data_ptr_cast(&buffer[0]), buffer.size());
+		if (!ReadHeader(stream, key)) {
+			return false;
+		}
+		optional<IcebergManifestMetadata> manifest_metadata;
+		if (stream.Read<bool>()) {
+			auto schema_id = stream.Read<int32_t>();
+			auto partition_spec_id = stream.Read<int32_t>();
+			auto format_version = stream.Read<int32_t>();
+			auto content = static_cast<IcebergManifestContentType>(stream.Read<uint8_t>());
+			manifest_metadata.emplace(schema_id, partition_spec_id, format_version, content);
+		}
+		auto entry_count = ReadLength<uint64_t>(stream, 1);
+		vector<IcebergManifestEntry> entries;
+		entries.reserve(entry_count);
+		auto batch = make_shared_ptr<IcebergColumnStatsBatch>();
+		for (idx_t i = 0; i < entry_count; i++) {
+			entries.push_back(ReadManifestEntry(stream, batch));
+		}
+
+		manifest.manifest_entries = std::move(entries);
+		if (!manifest.manifest_metadata && manifest_metadata) {
+			manifest.manifest_metadata.emplace(*manifest_metadata);
+		}
+		return true;
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg manifest cache: ignoring corrupt entry for '%s': %s",
+		           manifest.file.manifest_path, error.Message());
+		return false;
+	}
+}
+
+void IcebergManifestCache::StoreManifests(const vector<reference<const IcebergManifestListEntry>> &manifests,
+                                          idx_t iceberg_version) {
+	idx_t stored_count = 0;
+	for (auto &manifest_ref : manifests) {
+		auto &manifest = manifest_ref.get();
+		if (!manifest.HasManifestEntries()) {
+			continue;
+		}
+		auto key = ManifestKey(manifest.file, iceberg_version);
+		MemoryStream stream;
+		WriteHeader(stream, key);
+		stream.Write<bool>(manifest.manifest_metadata.has_value());
+		if (manifest.manifest_metadata) {
+			auto &manifest_metadata = *manifest.manifest_metadata;
+			stream.Write<int32_t>(manifest_metadata.schema_id);
+			stream.Write<int32_t>(manifest_metadata.partition_spec_id);
+			stream.Write<int32_t>(manifest_metadata.format_version);
+			stream.Write<uint8_t>(static_cast<uint8_t>(manifest_metadata.content));
+		}
+		auto &entries = manifest.GetManifestEntries();
+		stream.Write<uint64_t>(entries.size());
+		for (auto &entry : entries) {
+			WriteManifestEntry(stream, entry);
+		}
+		Write(key, StreamToString(stream));
+		stored_count++;
+	}
+	if (stored_count) {
+		EnforceSizeLimit();
+	}
+}
+
+} // namespace duckdb
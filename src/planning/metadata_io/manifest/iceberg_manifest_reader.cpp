@@ -8,6 +8,8 @@
 #include "duckdb/common/vector/list_vector.hpp"
 #include "duckdb/common/optional.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
 namespace manifest_file {
@@ -49,29 +51,36 @@ static optional<T> ReadOptionalField(const ENTRY &entry) {
 	return std::nullopt;
 }
 
-static unordered_map<int32_t, Value> GetBounds(const IntStringMapEntries::ValueEntry &entry) {
-	unordered_map<int32_t, Value> parsed_bounds;
+//! A single statistic of a single field, collected from the six statistics maps of a data file before they are
+//! merged into the rows of the IcebergColumnStatsBatch
+struct ColumnStatEntry {
+	int32_t field_id;
+	IcebergColumnStatType type;
+	int64_t count;
+	string_t bound;
+};
+
+static void CollectBounds(IcebergColumnStatType type, const IntStringMapEntries::ValueEntry &entry,
+                          vector<ColumnStatEntry> &result) {
 	if (!entry.IsValid()) {
-		return parsed_bounds;
+		return;
 	}
 
 	for (const auto bounds_entry : entry.GetChildValues()) {
 		auto key_entry = bounds_entry.template GetChildValue<0>();
 		auto value_entry = bounds_entry.template GetChildValue<1>();
-		auto value = Value(LogicalType::BLOB);
-		if (value_entry.IsValid()) {
-			auto &str = value_entry.GetValueUnsafe();
-			value = Value::BLOB(const_data_ptr_cast(str.GetData()), str.GetSize());
+		if (!value_entry.IsValid()) {
+			//! A NULL bound tells us as much as an absent one
+			continue;
 		}
-		parsed_bounds[key_entry.GetValueUnsafe()] = value;
+		result.push_back({key_entry.GetValueUnsafe(), type, 0, value_entry.GetValueUnsafe()});
 	}
-	return parsed_bounds;
 }
 
-static unordered_map<int32_t, int64_t> GetCounts(const char *name, const IntIntMapEntries::ValueEntry &entry) {
-	unordered_map<int32_t, int64_t> parsed_counts;
+static void CollectCounts(const char *name, IcebergColumnStatType type, const IntIntMapEntries::ValueEntry &entry,
+                          vector<ColumnStatEntry> &result) {
 	if (!entry.IsValid()) {
-		return parsed_counts;
+		return;
 	}
 
 	for (const auto count_entry : entry.GetChildValues()) {
@@ -81,9 +90,35 @@ static unordered_map<int32_t, int64_t> GetCounts(const char *name, const IntIntM
 		if (!value_entry.IsValid()) {
 			throw InvalidConfigurationException("'%s' map's value for key '%d' is NULL", name, key);
 		}
-		parsed_counts[key] = value_entry.GetValueUnsafe();
+		result.push_back({key, type, value_entry.GetValueUnsafe(), string_t()});
+	}
+}
+
+//! Append the collected statistics of one data file to 'batch' as rows sorted by field id, returns the row count
+static idx_t AppendColumnStats(vector<ColumnStatEntry> &entries, IcebergColumnStatsBatch &batch) {
+	std::stable_sort(entries.begin(), entries.end(), [](const ColumnStatEntry &a, const ColumnStatEntry &b) {
+		return a.field_id < b.field_id;
+	});
+	idx_t row_count = 0;
+	idx_t row_idx = 0;
+	for (idx_t i = 0; i < entries.size(); i++) {
+		auto &entry = entries[i];
+		if (i == 0 || entry.field_id != entries[i - 1].field_id) {
+			row_idx = batch.AppendRow(entry.field_id);
+			row_count++;
+		}
+		switch (entry.type) {
+		case IcebergColumnStatType::LOWER_BOUND:
+		case IcebergColumnStatType::UPPER_BOUND:
+			batch.SetBound(row_idx, entry.type, entry.bound.GetData(), entry.bound.GetSize());
+			break;
+		default:
+			batch.SetCount(row_idx, entry.type, entry.count);
+			break;
+		}
 	}
-	return parsed_counts;
+	entries.clear();
+	return row_count;
 }
 
 template <class T>
@@ -220,7 +255,12 @@ void ManifestReader::ReadChunk(DataChunk &chunk, const map<idx_t, LogicalType> &
 		}
 	}
 
+	//! The column statistics of all entries in this chunk share a single batch
+	auto stats_batch = make_shared_ptr<IcebergColumnStatsBatch>();
+	vector<ColumnStatEntry> stat_entries;
+
 	//! Conversion logic
+	result.reserve(result.size() + count);
 	for (idx_t i = 0; i < count; i++) {
 		IcebergManifestEntry entry;
 
@@ -232,12 +272,17 @@ void ManifestReader::ReadChunk(DataChunk &chunk, const map<idx_t, LogicalType> &
 		data_file.record_count = ReadRequiredField<int64_t>("record_count", record_count_entries[i]);
 		data_file.file_size_in_bytes = ReadRequiredField<int64_t>("file_size_in_bytes", file_size_in_bytes_entries[i]);
 
-		data_file.lower_bounds = GetBounds(lower_bounds_entries[i]);
-		data_file.upper_bounds = GetBounds(upper_bounds_entries[i]);
-		data_file.column_sizes = GetCounts("column_sizes", column_sizes_entries[i]);
-		data_file.value_counts = GetCounts("value_counts", value_counts_entries[i]);
-		data_file.null_value_counts = GetCounts("null_value_counts", null_value_counts_entries[i]);
-		data_file.nan_value_counts = GetCounts("nan_value_counts", nan_value_counts_entries[i]);
+		CollectCounts("column_sizes", IcebergColumnStatType::COLUMN_SIZE, column_sizes_entries[i], stat_entries);
+		CollectCounts("value_counts", IcebergColumnStatType::VALUE_COUNT, value_counts_entries[i], stat_entries);
+		CollectCounts("null_value_counts", IcebergColumnStatType::NULL_VALUE_COUNT, null_value_counts_entries[i],
+		              stat_entries);
+		CollectCounts("nan_value_counts", IcebergColumnStatType::NAN_VALUE_COUNT, nan_value_counts_entries[i],
+		              stat_entries);
+		CollectBounds(IcebergColumnStatType::LOWER_BOUND, lower_bounds_entries[i], stat_entries);
+		CollectBounds(IcebergColumnStatType::UPPER_BOUND, upper_bounds_entries[i], stat_entries);
+		auto stats_offset = stats_batch->Size();
+		auto stats_count = AppendColumnStats(stat_entries, *stats_batch);
+		data_file.column_stats = IcebergColumnStats(stats_batch, stats_offset, stats_count);
 
 		data_file.split_offsets = GetSplitOffsets(split_offsets_entries[i]);
 		data_file.sort_order_id = ReadOptionalField<int32_t>(sort_order_id_entries[i]);
@@ -292,7 +337,7 @@ void ManifestReader::ReadChunk(DataChunk &chunk, const map<idx_t, LogicalType> &
 				}
 			}
 		}
-		result.push_back(entry);
+		result.push_back(std::move(entry));
 	}
 }
 
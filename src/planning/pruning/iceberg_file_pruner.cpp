@@ -1,29 +1,29 @@
 #include "planning/pruning/iceberg_file_pruner.hpp"
 
 #include "core/expression/iceberg_predicate_stats.hpp"
+#include "core/expression/iceberg_value.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/logging/logger.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/filter/table_filter_functions.hpp"
 #include "iceberg_logging.hpp"
 #include "planning/pruning/iceberg_predicate.hpp"
 #include "storage/statistics/iceberg_variant_statistics.hpp"
 
+#include <cstring>
+
 namespace duckdb {
 
 namespace {
 
 //! How many of a column's values in a data file are NULL, from the counts its manifest entry carries. An absent
 //! null count tells us nothing, so assume both kinds of row are present.
-void ApplyNullCounts(const IcebergDataFile &data_file, int32_t column_id, IcebergPredicateStats &stats) {
-	optional<int64_t> value_count;
-	optional<int64_t> null_count;
-	auto value_counts_it = data_file.value_counts.find(column_id);
-	if (value_counts_it != data_file.value_counts.end()) {
-		value_count = value_counts_it->second;
-	}
-	auto null_counts_it = data_file.null_value_counts.find(column_id);
-	if (null_counts_it != data_file.null_value_counts.end()) {
-		null_count = null_counts_it->second;
-	}
+void ApplyNullCounts(const IcebergColumnStats &column_stats, int32_t column_id, IcebergPredicateStats &stats) {
+	auto value_count = column_stats.ValueCount(column_id);
+	auto null_count = column_stats.NullValueCount(column_id);
 
 	if (null_count) {
 		stats.has_null = *null_count > 0;
@@ -34,151 +34,458 @@ void ApplyNullCounts(const IcebergDataFile &data_file, int32_t column_id, Iceber
 	}
 }
 
-} // namespace
-
-bool IcebergFilePruner::FilePartitionMatchesFilter(const IcebergDataFile &data_file,
-                                                   const IcebergManifestFile &manifest_file) const {
-	if (data_file.partition_info.empty()) {
+bool IsDirectReference(const Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_REF:
+	case ExpressionClass::BOUND_COLUMN_REF:
 		return true;
+	default:
+		return false;
 	}
+}
 
-	auto partition_spec_it = metadata.partition_specs.find(manifest_file.partition_spec_id);
-	if (partition_spec_it == metadata.partition_specs.end()) {
-		throw InvalidConfigurationException(
-		    "Data file %s has partition spec %d while the metadata does not have this partition spec",
-		    data_file.file_path, manifest_file.partition_spec_id);
+bool TryGetIntegralConstant(const Value &constant, LogicalTypeId type_id, int64_t &result) {
+	if (constant.IsNull() || constant.type().id() != type_id) {
+		return false;
 	}
-	auto &partition_spec = partition_spec_it->second;
-	auto &source_to_column_id = schema.GetSourceIdMap();
-
-	unordered_map<uint64_t, idx_t> partition_info_map;
-	for (idx_t i = 0; i < data_file.partition_info.size(); i++) {
-		partition_info_map.emplace(data_file.partition_info[i].field_id, i);
+	switch (type_id) {
+	case LogicalTypeId::INTEGER:
+		result = constant.GetValue<int32_t>();
+		return true;
+	case LogicalTypeId::BIGINT:
+		result = constant.GetValue<int64_t>();
+		return true;
+	case LogicalTypeId::DATE:
+		result = constant.GetValue<date_t>().days;
+		return true;
+	case LogicalTypeId::TIMESTAMP:
+		result = constant.GetValue<timestamp_t>().value;
+		return true;
+	case LogicalTypeId::TIMESTAMP_TZ:
+		result = constant.GetValue<timestamp_tz_t>().value;
+		return true;
+	default:
+		return false;
 	}
+}
 
-	for (auto &field : partition_spec.fields) {
-		const auto &column_id = source_to_column_id.at(field.source_id);
-		auto table_filter = table_filters.GetFilterForColumnIndex(column_id);
-		if (!table_filter) {
-			continue;
+//! Mirrors the shapes IcebergPredicate::MatchBounds evaluates with MatchBoundsConstant, anything else is left to it
+bool CompileComparisons(const Expression &expr, IcebergIntegralBoundsKernel &kernel) {
+	if (BoundComparisonExpression::IsComparison(expr)) {
+		auto comparison_type = expr.GetExpressionType();
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			break;
+		default:
+			return false;
+		}
+		auto &compare_expr = expr.Cast<BoundFunctionExpression>();
+		auto &left = BoundComparisonExpression::Left(compare_expr);
+		auto &right = BoundComparisonExpression::Right(compare_expr);
+		optional_ptr<const Expression> constant_expr;
+		if (IsDirectReference(left) && right.GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+			constant_expr = &right;
+		} else if (IsDirectReference(right) && left.GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+			constant_expr = &left;
+			comparison_type = FlipComparisonExpression(comparison_type);
+		} else {
+			return false;
+		}
+		IcebergIntegralBoundsKernel::Comparison comparison;
+		comparison.type = comparison_type;
+		if (!TryGetIntegralConstant(constant_expr->Cast<BoundConstantExpression>().GetValue(), kernel.type_id,
+		                            comparison.constant)) {
+			return false;
 		}
+		kernel.comparisons.push_back(comparison);
+		return true;
+	}
 
-		IcebergPredicateStats stats;
-		auto it = partition_info_map.find(field.partition_field_id);
-		if (it == partition_info_map.end()) {
-			continue;
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		if (expr.GetExpressionType() != ExpressionType::CONJUNCTION_AND) {
+			return false;
 		}
-		auto &partition_val = data_file.partition_info[it->second];
-		stats.lower_bound = partition_val.value;
-		stats.upper_bound = partition_val.value;
-		if (partition_val.value.IsNull()) {
-			stats.has_null = true;
-		} else {
-			stats.has_not_null = true;
+		for (auto &child : expr.Cast<BoundConjunctionExpression>().GetChildren()) {
+			if (!CompileComparisons(*child, kernel)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case ExpressionClass::BOUND_FUNCTION: {
+		auto &func = expr.Cast<BoundFunctionExpression>();
+		if (!func.BindInfo()) {
+			return false;
+		}
+		if (func.Function().GetName() == OptionalFilterScalarFun::NAME) {
+			auto &data = func.BindInfo()->Cast<OptionalFilterFunctionData>();
+			return data.child_filter_expr && CompileComparisons(*data.child_filter_expr, kernel);
 		}
+		if (func.Function().GetName() == SelectivityOptionalFilterScalarFun::NAME) {
+			auto &data = func.BindInfo()->Cast<SelectivityOptionalFilterFunctionData>();
+			return data.child_filter_expr && CompileComparisons(*data.child_filter_expr, kernel);
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+template <class T>
+bool TryDecodeInteger(const string_t &bound, int64_t &result) {
+	if (bound.GetSize() != sizeof(T)) {
+		return false;
+	}
+	T value;
+	std::memcpy(&value, bound.GetData(), sizeof(T));
+	result = value;
+	return true;
+}
+
+string BoundToString(const optional<string_t> &bound, const LogicalType &type) {
+	if (!bound) {
+		return "N/A";
+	}
+	auto deserialized = IcebergValue::DeserializeValue(*bound, type);
+	return deserialized.HasError() ? "N/A" : deserialized.GetValue().ToString();
+}
 
-		auto nan_counts_it = data_file.nan_value_counts.find(column_id.GetPrimaryIndex());
-		if (nan_counts_it != data_file.nan_value_counts.end()) {
-			stats.has_nan = nan_counts_it->second != 0;
+//! Keep the files 'predicate' holds for, in place
+template <class PREDICATE>
+void SelectFiles(vector<reference<const IcebergManifestEntry>> &files, PREDICATE &&predicate) {
+	idx_t result_count = 0;
+	for (idx_t file_idx = 0; file_idx < files.size(); file_idx++) {
+		if (predicate(files[file_idx].get())) {
+			files[result_count++] = files[file_idx];
 		}
+	}
+	files.erase(files.begin() + NumericCast<int64_t>(result_count), files.end());
+}
 
-		if (!IcebergPredicate::MatchBounds(context, *table_filter, stats, field.transform)) {
-			auto &source_column = IcebergTableSchema::GetFromColumnIndex(schema.columns, column_id, 0);
-			auto partition_value_raw_str = stats.lower_bound ? stats.lower_bound->ToString() : "NULL";
-			auto partition_value_transformed_str =
-			    stats.lower_bound ? field.transform.PartitionValueToString(*stats.lower_bound) : "NULL";
-			DUCKDB_LOG(context, IcebergLogType,
-			           "Iceberg Filter Pushdown, skipped 'data_file': '%s', partition column '%s' has raw value %s "
-			           "with transform '%s'. '%s(%s)=%s' does not match filter: %s",
-			           data_file.file_path, source_column.name, partition_value_raw_str, field.transform.RawType(),
-			           field.transform.RawType(), partition_value_raw_str, partition_value_transformed_str,
-			           table_filter->ToString(source_column.name));
+} // namespace
+
+bool IcebergIntegralBoundsKernel::Compile(const Expression &expr, const LogicalType &column_type) {
+	type_id = column_type.id();
+	switch (type_id) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		break;
+	default:
+		return false;
+	}
+	comparisons.clear();
+	return CompileComparisons(expr, *this) && !comparisons.empty();
+}
+
+bool IcebergIntegralBoundsKernel::TryDecode(const string_t &bound, int64_t &result) const {
+	//! Same encodings as IcebergValue::DeserializeValue accepts for these types
+	switch (type_id) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+		return TryDecodeInteger<int32_t>(bound, result);
+	case LogicalTypeId::BIGINT:
+		return TryDecodeInteger<int64_t>(bound, result) || TryDecodeInteger<int32_t>(bound, result);
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return TryDecodeInteger<int64_t>(bound, result);
+	default:
+		return false;
+	}
+}
+
+bool IcebergIntegralBoundsKernel::Matches(int64_t lower_bound, int64_t upper_bound) const {
+	for (auto &comparison : comparisons) {
+		auto constant = comparison.constant;
+		bool matches;
+		switch (comparison.type) {
+		case ExpressionType::COMPARE_EQUAL:
+			matches = constant >= lower_bound && constant <= upper_bound;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			matches = upper_bound > constant;
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			matches = upper_bound >= constant;
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+			matches = lower_bound < constant;
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			matches = lower_bound <= constant;
+			break;
+		default:
+			throw InternalException("Unsupported comparison in IcebergIntegralBoundsKernel");
+		}
+		if (!matches) {
 			return false;
 		}
 	}
 	return true;
 }
 
-bool IcebergFilePruner::FileMatchesFilter(const IcebergManifestFile &manifest_file,
-                                          const IcebergManifestEntry &manifest_entry) const {
-	D_ASSERT(table_filters.HasFilters());
-	unordered_set<int32_t> mapping_field_ids;
+IcebergFilePruner::IcebergFilePruner(ClientContext &context, const IcebergTableMetadata &metadata,
+                                     const IcebergTableSchema &schema, const IcebergTableFilters &table_filters)
+    : context(context), metadata(metadata), schema(schema), table_filters(table_filters) {
 	for (auto &mapping : metadata.mappings) {
 		if (mapping.field_id != NumericLimits<int32_t>::Maximum()) {
 			mapping_field_ids.insert(mapping.field_id);
 		}
 	}
-
-	auto &data_file = manifest_entry.data_file;
-	if (!FilePartitionMatchesFilter(data_file, manifest_file)) {
-		return false;
+	if (!table_filters.HasFilters()) {
+		return;
 	}
+	CompileColumnSteps();
+	CompilePartitionSteps();
+}
 
+void IcebergFilePruner::CompileColumnSteps() {
 	for (auto &entry : table_filters) {
-		auto &column_index = entry.first;
-		auto primary_index = column_index.GetPrimaryIndex();
-		auto &column = *schema.columns[primary_index];
-
-		if (data_file.lower_bounds.empty() || data_file.upper_bounds.empty() ||
-		    data_file.content == IcebergManifestEntryContentType::POSITION_DELETES) {
+		auto &column = *schema.columns[entry.first.GetPrimaryIndex()];
+		if (!metadata.mappings.empty() && mapping_field_ids.find(column.id) == mapping_field_ids.end()) {
 			continue;
 		}
-
-		auto &column_id = column.id;
-		if (!metadata.mappings.empty() && mapping_field_ids.find(column_id) == mapping_field_ids.end()) {
-			continue;
+		IcebergColumnPruningStep step(column, *entry.second);
+		auto kernel = make_uniq<IcebergIntegralBoundsKernel>();
+		if (kernel->Compile(*entry.second->expr, column.type)) {
+			step.kernel = std::move(kernel);
 		}
+		column_steps.push_back(std::move(step));
+	}
+}
 
-		auto lower_bound_it = data_file.lower_bounds.find(column_id);
-		auto upper_bound_it = data_file.upper_bounds.find(column_id);
-		Value lower_bound;
-		Value upper_bound;
-		if (lower_bound_it != data_file.lower_bounds.end()) {
-			lower_bound = lower_bound_it->second;
-		}
-		if (upper_bound_it != data_file.upper_bounds.end()) {
-			upper_bound = upper_bound_it->second;
+void IcebergFilePruner::CompilePartitionSteps() {
+	auto &source_to_column_id = schema.GetSourceIdMap();
+	for (auto &entry : metadata.partition_specs) {
+		//! Every known spec gets an entry, even without steps, so a missing entry means an unknown spec
+		auto &steps = partition_steps[entry.first];
+		auto &fields = entry.second.fields;
+		for (idx_t field_idx = 0; field_idx < fields.size(); field_idx++) {
+			auto &field = fields[field_idx];
+			auto column_id_it = source_to_column_id.find(field.source_id);
+			if (column_id_it == source_to_column_id.end()) {
+				//! The source column is not part of the scanned schema, so it can not be filtered on
+				continue;
+			}
+			auto &column_id = column_id_it->second;
+			auto filter = table_filters.GetFilterForColumnIndex(column_id);
+			if (!filter) {
+				continue;
+			}
+			auto &source_column = IcebergTableSchema::GetFromColumnIndex(schema.columns, column_id, 0);
+			steps.push_back(IcebergPartitionPruningStep {field_idx, field, source_column,
+			                                             NumericCast<int32_t>(column_id.GetPrimaryIndex()),
+			                                             std::move(filter)});
 		}
-		IcebergPredicateStats stats;
+	}
+}
 
-		if (column.type.id() == LogicalTypeId::VARIANT) {
-			if (lower_bound.IsNull() || upper_bound.IsNull()) {
-				return true;
+void IcebergFilePruner::PruneFilesOnPartition(const IcebergManifestFile &manifest_file,
+                                              file_selection_t &files) const {
+	auto steps_it = partition_steps.find(manifest_file.partition_spec_id);
+	if (steps_it == partition_steps.end()) {
+		for (auto &file : files) {
+			auto &data_file = file.get().data_file;
+			if (!data_file.partition_info.empty()) {
+				throw InvalidConfigurationException(
+				    "Data file %s has partition spec %d while the metadata does not have this partition spec",
+				    data_file.file_path, manifest_file.partition_spec_id);
 			}
-			Value lower_decoded;
-			Value upper_decoded;
-			Value lower_variant;
-			Value upper_variant;
-			auto lower_blob = lower_bound.GetValueUnsafe<string_t>();
-			auto upper_blob = upper_bound.GetValueUnsafe<string_t>();
-			if (IcebergVariantBoundsReader::Deserialize(context, lower_blob, lower_decoded) &&
-			    IcebergVariantBoundsReader::RekeyBoundsVariant(lower_decoded, lower_variant)) {
-				stats.SetLowerBound(lower_variant);
+		}
+		return;
+	}
+
+	for (auto &step : steps_it->second) {
+		auto &field = step.field;
+		auto &source_column = step.source_column;
+		auto &table_filter = *step.filter;
+		SelectFiles(files, [&](const IcebergManifestEntry &manifest_entry) {
+			auto &data_file = manifest_entry.data_file;
+			optional_ptr<const Value> partition_value;
+			for (auto &partition : data_file.partition_info) {
+				if (partition.field_id == field.partition_field_id) {
+					partition_value = &partition.value;
+					break;
+				}
 			}
-			if (IcebergVariantBoundsReader::Deserialize(context, upper_blob, upper_decoded) &&
-			    IcebergVariantBoundsReader::RekeyBoundsVariant(upper_decoded, upper_variant)) {
-				stats.SetUpperBound(upper_variant);
+			if (!partition_value) {
+				return true;
 			}
-		} else {
-			stats = IcebergPredicateStats::DeserializeBounds(lower_bound, upper_bound, column.name, column.type);
-		}
 
-		ApplyNullCounts(data_file, column_id, stats);
+			IcebergPredicateStats stats;
+			stats.lower_bound = *partition_value;
+			stats.upper_bound = *partition_value;
+			if (partition_value->IsNull()) {
+				stats.has_null = true;
+			} else {
+				stats.has_not_null = true;
+			}
+			auto nan_count = data_file.column_stats.NanValueCount(step.nan_count_field_id);
+			if (nan_count) {
+				stats.has_nan = *nan_count != 0;
+			}
 
-		auto nan_counts_it = data_file.nan_value_counts.find(column_id);
-		stats.has_nan = nan_counts_it == data_file.nan_value_counts.end() || nan_counts_it->second > 0;
+			if (IcebergPredicate::MatchBounds(context, table_filter, stats, field.transform)) {
+				return true;
+			}
+			auto partition_value_raw_str = partition_value->ToString();
+			auto partition_value_transformed_str = field.transform.PartitionValueToString(*partition_value);
+			DUCKDB_LOG(context, IcebergLogType,
+			           "Iceberg Filter Pushdown, skipped 'data_file': '%s', partition column '%s' has raw value %s "
+			           "with transform '%s'. '%s(%s)=%s' does not match filter: %s",
+			           data_file.file_path, source_column.name, partition_value_raw_str, field.transform.RawType(),
+			           field.transform.RawType(), partition_value_raw_str, partition_value_transformed_str,
+			           table_filter.ToString(source_column.name));
+			return false;
+		});
+		if (files.empty()) {
+			return;
+		}
+	}
+}
 
-		auto &filter = *entry.second;
-		if (!IcebergPredicate::MatchBounds(context, filter, stats, IcebergTransform::Identity())) {
+bool IcebergFilePruner::FileMatchesColumnStep(const IcebergDataFile &data_file,
+                                              const IcebergColumnPruningStep &step) const {
+	auto &column_stats = data_file.column_stats;
+	auto &column = step.column;
+	auto column_id = column.id;
+	auto lower_bound = column_stats.LowerBound(column_id);
+	auto upper_bound = column_stats.UpperBound(column_id);
+
+	if (step.kernel) {
+		auto &kernel = *step.kernel;
+		int64_t lower_value = 0;
+		int64_t upper_value = 0;
+		bool decoded = (!lower_bound || kernel.TryDecode(*lower_bound, lower_value)) &&
+		               (!upper_bound || kernel.TryDecode(*upper_bound, upper_value));
+		if (decoded) {
+			IcebergPredicateStats null_stats;
+			ApplyNullCounts(column_stats, column_id, null_stats);
+			if (null_stats.has_not_null && (!lower_bound || !upper_bound)) {
+				return true;
+			}
+			if (null_stats.has_not_null && kernel.Matches(lower_value, upper_value)) {
+				return true;
+			}
 			DUCKDB_LOG(context, IcebergLogType,
 			           "Iceberg Filter Pushdown, skipped 'data_file': '%s', column '%s' with "
 			           "bounds [%s, %s] did not match filter: %s",
-			           data_file.file_path, column.name, stats.lower_bound ? stats.lower_bound->ToString() : "N/A",
-			           stats.upper_bound ? stats.upper_bound->ToString() : "N/A", filter.ToString(column.name));
+			           data_file.file_path, column.name, BoundToString(lower_bound, column.type),
+			           BoundToString(upper_bound, column.type), step.filter.ToString(column.name));
 			return false;
 		}
+		//! Not the encoding the kernel expects, let the generic path below deal with it
+	}
+
+	IcebergPredicateStats stats;
+	if (column.type.id() == LogicalTypeId::VARIANT) {
+		if (!lower_bound || !upper_bound) {
+			return true;
+		}
+		Value lower_decoded;
+		Value upper_decoded;
+		Value lower_variant;
+		Value upper_variant;
+		auto &lower_blob = *lower_bound;
+		auto &upper_blob = *upper_bound;
+		if (IcebergVariantBoundsReader::Deserialize(context, lower_blob, lower_decoded) &&
+		    IcebergVariantBoundsReader::RekeyBoundsVariant(lower_decoded, lower_variant)) {
+			stats.SetLowerBound(lower_variant);
+		}
+		if (IcebergVariantBoundsReader::Deserialize(context, upper_blob, upper_decoded) &&
+		    IcebergVariantBoundsReader::RekeyBoundsVariant(upper_decoded, upper_variant)) {
+			stats.SetUpperBound(upper_variant);
+		}
+	} else {
+		stats = IcebergPredicateStats::DeserializeBounds(lower_bound, upper_bound, column.name, column.type);
+	}
+
+	ApplyNullCounts(column_stats, column_id, stats);
+
+	auto nan_count = column_stats.NanValueCount(column_id);
+	stats.has_nan = !nan_count || *nan_count > 0;
+
+	if (IcebergPredicate::MatchBounds(context, step.filter, stats, IcebergTransform::Identity())) {
+		return true;
+	}
+	DUCKDB_LOG(context, IcebergLogType,
+	           "Iceberg Filter Pushdown, skipped 'data_file': '%s', column '%s' with "
+	           "bounds [%s, %s] did not match filter: %s",
+	           data_file.file_path, column.name, stats.lower_bound ? stats.lower_bound->ToString() : "N/A",
+	           stats.upper_bound ? stats.upper_bound->ToString() : "N/A", step.filter.ToString(column.name));
+	return false;
+}
+
+void IcebergFilePruner::PruneFilesOnColumnStats(file_selection_t &files) const {
+	if (column_steps.empty()) {
+		return;
+	}
+	//! Positional delete files, and files without bounds, can not be pruned on their column statistics
+	file_selection_t unprunable_files;
+	SelectFiles(files, [&](const IcebergManifestEntry &manifest_entry) {
+		auto &data_file = manifest_entry.data_file;
+		auto &column_stats = data_file.column_stats;
+		if (data_file.content != IcebergManifestEntryContentType::POSITION_DELETES &&
+		    column_stats.HasAny(IcebergColumnStatType::LOWER_BOUND) &&
+		    column_stats.HasAny(IcebergColumnStatType::UPPER_BOUND)) {
+			return true;
+		}
+		unprunable_files.push_back(manifest_entry);
+		return false;
+	});
+
+	for (auto &step : column_steps) {
+		if (files.empty()) {
+			break;
+		}
+		SelectFiles(files, [&](const IcebergManifestEntry &manifest_entry) {
+			return FileMatchesColumnStep(manifest_entry.data_file, step);
+		});
+	}
+	files.insert(files.end(), unprunable_files.begin(), unprunable_files.end());
+}
+
+void IcebergFilePruner::PruneFiles(const IcebergManifestFile &manifest_file, file_selection_t &files) const {
+	PruneFilesOnPartition(manifest_file, files);
+	PruneFilesOnColumnStats(files);
+}
+
+bool IcebergFilePruner::FileMatchesFilter(const IcebergManifestFile &manifest_file,
+                                          const IcebergManifestEntry &manifest_entry) const {
+	D_ASSERT(table_filters.HasFilters());
+	file_selection_t files {manifest_entry};
+	PruneFiles(manifest_file, files);
+	return !files.empty();
+}
+
+void IcebergFilePruner::FilterFiles(const IcebergManifestFile &manifest_file,
+                                    const vector<IcebergManifestEntry> &manifest_entries, idx_t begin, idx_t end,
+                                    vector<bool> &matches) const {
+	D_ASSERT(begin <= end && end <= manifest_entries.size());
+	matches.assign(end - begin, false);
+	file_selection_t files;
+	files.reserve(end - begin);
+	for (idx_t entry_idx = begin; entry_idx < end; entry_idx++) {
+		auto &manifest_entry = manifest_entries[entry_idx];
+		if (manifest_entry.status != IcebergManifestEntryStatusType::DELETED) {
+			files.push_back(manifest_entry);
+		}
+	}
+	if (table_filters.HasFilters()) {
+		PruneFiles(manifest_file, files);
+	}
+	for (auto &file : files) {
+		auto entry_idx = NumericCast<idx_t>(&file.get() - manifest_entries.data());
+		matches[entry_idx - begin] = true;
 	}
-	return true;
 }
 
 bool IcebergFilePruner::DeleteManifestMatchesDataFile(const IcebergManifestFile &delete_manifest,
@@ -258,20 +565,21 @@ bool IcebergFilePruner::DeleteManifestMatchesDataFile(const IcebergManifestFile
 bool IcebergFilePruner::EqualityDeleteMatchesDataFile(const IcebergDataFile &delete_file,
                                                       const IcebergDataFile &data_file) const {
 	auto &equality_ids = delete_file.equality_ids;
+	auto &delete_column_stats = delete_file.column_stats;
+	auto &data_column_stats = data_file.column_stats;
 
 	for (auto field_id : equality_ids) {
-		auto delete_null_count = delete_file.null_value_counts.find(field_id);
-		if (delete_null_count == delete_file.null_value_counts.end() || delete_null_count->second != 0) {
+		auto delete_null_count = delete_column_stats.NullValueCount(field_id);
+		if (!delete_null_count || *delete_null_count != 0) {
 			//! A NULL delete key can match NULL data values - require a known zero null count
 			continue;
 		}
 
-		auto delete_lower = delete_file.lower_bounds.find(field_id);
-		auto delete_upper = delete_file.upper_bounds.find(field_id);
-		auto data_lower = data_file.lower_bounds.find(field_id);
-		auto data_upper = data_file.upper_bounds.find(field_id);
-		if (delete_lower == delete_file.lower_bounds.end() || delete_upper == delete_file.upper_bounds.end() ||
-		    data_lower == data_file.lower_bounds.end() || data_upper == data_file.upper_bounds.end()) {
+		auto delete_lower = delete_column_stats.LowerBound(field_id);
+		auto delete_upper = delete_column_stats.UpperBound(field_id);
+		auto data_lower = data_column_stats.LowerBound(field_id);
+		auto data_upper = data_column_stats.UpperBound(field_id);
+		if (!delete_lower || !delete_upper || !data_lower || !data_upper) {
 			continue;
 		}
 
@@ -282,18 +590,18 @@ bool IcebergFilePruner::EqualityDeleteMatchesDataFile(const IcebergDataFile &del
 		}
 		auto &column = *column_p;
 		if (column.type.id() == LogicalTypeId::FLOAT || column.type.id() == LogicalTypeId::DOUBLE) {
-			auto delete_nan_count = delete_file.nan_value_counts.find(field_id);
-			if (delete_nan_count == delete_file.nan_value_counts.end() || delete_nan_count->second != 0) {
+			auto delete_nan_count = delete_column_stats.NanValueCount(field_id);
+			if (!delete_nan_count || *delete_nan_count != 0) {
 				//! Manifest bounds exclude NaNs - require a known zero NaN count
 				continue;
 			}
 		}
 
 		try {
-			auto delete_stats = IcebergPredicateStats::DeserializeBounds(delete_lower->second, delete_upper->second,
-			                                                             column.name, column.type);
-			auto data_stats = IcebergPredicateStats::DeserializeBounds(data_lower->second, data_upper->second,
-			                                                           column.name, column.type);
+			auto delete_stats =
+			    IcebergPredicateStats::DeserializeBounds(delete_lower, delete_upper, column.name, column.type);
+			auto data_stats =
+			    IcebergPredicateStats::DeserializeBounds(data_lower, data_upper, column.name, column.type);
 			if (!delete_stats.lower_bound || !delete_stats.upper_bound || !data_stats.lower_bound ||
 			    !data_stats.upper_bound || delete_stats.lower_bound->IsNull() || delete_stats.upper_bound->IsNull() ||
 			    data_stats.lower_bound->IsNull() || data_stats.upper_bound->IsNull()) {
@@ -425,17 +733,13 @@ bool IcebergFilePruner::ManifestMatchesFilter(const IcebergManifestFile &manifes
 		return true;
 	}
 
-	auto &source_to_column_id = schema.GetSourceIdMap();
-	for (idx_t i = 0; i < field_summaries.size(); i++) {
-		auto &field_summary = field_summaries[i];
-		auto &field = partition_spec.fields[i];
-		const auto &column_id = source_to_column_id.at(field.source_id);
-		auto table_filter = table_filters.GetFilterForColumnIndex(column_id);
-		if (!table_filter) {
-			continue;
-		}
-
-		auto &column = IcebergTableSchema::GetFromColumnIndex(schema.columns, column_id, 0);
+	auto steps_it = partition_steps.find(spec_id);
+	D_ASSERT(steps_it != partition_steps.end());
+	for (auto &step : steps_it->second) {
+		auto &field_summary = field_summaries[step.field_idx];
+		auto &field = step.field;
+		auto &column = step.source_column;
+		auto &table_filter = *step.filter;
 		auto result_type = field.transform.GetSerializedType(column.type);
 		auto stats = IcebergPredicateStats::DeserializeBounds(field_summary.lower_bound, field_summary.upper_bound,
 		                                                      column.name, result_type);
@@ -443,13 +747,13 @@ bool IcebergFilePruner::ManifestMatchesFilter(const IcebergManifestFile &manifes
 		stats.has_null = field_summary.contains_null;
 		stats.has_not_null = true;
 
-		if (!IcebergPredicate::MatchBounds(context, *table_filter, stats, field.transform)) {
+		if (!IcebergPredicate::MatchBounds(context, table_filter, stats, field.transform)) {
 			DUCKDB_LOG(context, IcebergLogType,
 			           "Iceberg Filter Pushdown, skipped 'manifest_file': '%s', column '%s' with "
 			           "transform '%s', bounds [%s, %s] did not match filter: %s",
 			           manifest.manifest_path, column.name, field.transform.RawType(),
 			           stats.lower_bound ? stats.lower_bound->ToString() : "N/A",
-			           stats.upper_bound ? stats.upper_bound->ToString() : "N/A", table_filter->ToString(column.name));
+			           stats.upper_bound ? stats.upper_bound->ToString() : "N/A", table_filter.ToString(column.name));
 			return false;
 		}
 	}
@@ -77,18 +77,18 @@ void IcebergScanOrder::Apply(ClientContext &context, const IcebergTableSchema &s
 	order_entries.reserve(manifest_entries.size());
 	for (idx_t i = 0; i < manifest_entries.size(); i++) {
 		auto &data_file = manifest_entries[i].entry.data_file;
-		auto lower_it = data_file.lower_bounds.find(field_id);
-		auto upper_it = data_file.upper_bounds.find(field_id);
-		if (lower_it == data_file.lower_bounds.end() || upper_it == data_file.upper_bounds.end()) {
+		auto &column_stats = data_file.column_stats;
+		auto lower = column_stats.LowerBound(field_id);
+		auto upper = column_stats.UpperBound(field_id);
+		if (!lower || !upper) {
 			return;
 		}
-		auto stats = IcebergPredicateStats::DeserializeBounds(lower_it->second, upper_it->second, order_column.name,
-		                                                      order_column.type);
+		auto stats = IcebergPredicateStats::DeserializeBounds(lower, upper, order_column.name, order_column.type);
 		if (!stats.lower_bound || !stats.upper_bound || stats.lower_bound->IsNull() || stats.upper_bound->IsNull()) {
 			return;
 		}
-		auto null_it = data_file.null_value_counts.find(field_id);
-		if (null_it == data_file.null_value_counts.end() || null_it->second > 0) {
+		auto null_count = column_stats.NullValueCount(field_id);
+		if (!null_count || *null_count > 0) {
 			can_prune = false;
 		}
 		order_entries.push_back(
@@ -17,6 +17,7 @@
 #include "planning/metadata_io/avro/avro_scan.hpp"
 #include "planning/metadata_io/manifest/iceberg_manifest_reader.hpp"
 #include "planning/metadata_io/manifest_list/iceberg_manifest_list_reader.hpp"
+#include "planning/scan_plan/iceberg_scan_plan_cache.hpp"
 
 #include <condition_variable>
 
@@ -50,6 +51,7 @@ public:
 			return TaskExecutionResult::TASK_NOT_FINISHED;
 		}
 		--state.in_progress_tasks;
+		NotifyConsumers();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
 
@@ -77,9 +79,17 @@ public:
 			executor.PushError(ErrorData("Unknown exception during Checkpoint!"));
 		} // LCOV_EXCL_STOP
 		executor.FinishTask();
+		NotifyConsumers();
 		return TaskExecutionResult::TASK_ERROR;
 	}
 
+private:
+	void NotifyConsumers() {
+		if (state.read_state) {
+			state.read_state->NotifyConsumers();
+		}
+	}
+
 private:
 	IcebergManifestScanningState &state;
 	manifest_file::ManifestReader reader;
@@ -98,7 +108,7 @@ void ClientSideScanPlanProvider::LoadManifestList() {
 	}
 
 	auto &snapshot_info = context.snapshot;
-	if (snapshot_info.snapshot) {
+	if (snapshot_info.snapshot && !TryRestoreCachedScanPlan()) {
 		auto &iceberg_path = context.path;
 		auto &snapshot = *snapshot_info.snapshot;
 		auto &metadata = context.metadata;
@@ -114,11 +124,20 @@ void ClientSideScanPlanProvider::LoadManifestList() {
 				auto manifest_list_full_path = context.options.allow_moved_paths
 				                                   ? IcebergUtils::GetFullPath(iceberg_path, snapshot.manifest_list, fs)
 				                                   : snapshot.manifest_list;
-				auto scan = AvroScan::ScanManifestList(snapshot_info, metadata, context.context,
-				                                       manifest_list_full_path, manifest_list_entries);
-				auto manifest_list_reader = make_uniq<manifest_list::ManifestListReader>(*scan);
-				while (!manifest_list_reader->Finished()) {
-					manifest_list_reader->Read();
+				auto &manifest_cache = shared_state.manifest_cache;
+				if (!manifest_cache || !manifest_cache->TryLoadManifestList(manifest_list_full_path,
+				                                                            metadata.iceberg_version,
+				                                                            manifest_list_entries)) {
+					auto scan = AvroScan::ScanManifestList(snapshot_info, metadata, context.context,
+					                                       manifest_list_full_path, manifest_list_entries);
+					auto manifest_list_reader = make_uniq<manifest_list::ManifestListReader>(*scan);
+					while (!manifest_list_reader->Finished()) {
+						manifest_list_reader->Read();
+					}
+					if (manifest_cache) {
+						manifest_cache->StoreManifestList(manifest_list_full_path, metadata.iceberg_version,
+						                                  manifest_list_entries);
+					}
 				}
 			}
 		}
@@ -147,7 +166,13 @@ void ClientSideScanPlanProvider::LoadManifestList() {
 
 			auto &counts = manifest.file.counts;
 			if (!counts || !counts->FilesComplete()) {
-				manifests_to_eagerly_load.push_back(manifest_idx);
+				auto &manifest_cache = shared_state.manifest_cache;
+				if (manifest_cache && manifest_cache->TryLoadManifest(manifest, context.metadata.iceberg_version)) {
+					manifest.file.SetCountsFromEntries(manifest.GetManifestEntries());
+					shared_state.eagerly_loaded_data_manifests[manifest_idx] = true;
+				} else {
+					manifests_to_eagerly_load.push_back(manifest_idx);
+				}
 				continue;
 			}
 
@@ -164,10 +189,15 @@ void ClientSideScanPlanProvider::LoadManifestList() {
 			while (!reader->Finished()) {
 				reader->Read();
 			}
+			vector<reference<const IcebergManifestListEntry>> loaded_manifests;
 			for (auto manifest_idx : manifests_to_eagerly_load) {
 				auto &manifest = data_manifests[manifest_idx];
 				manifest.file.SetCountsFromEntries(manifest.GetManifestEntries());
 				shared_state.eagerly_loaded_data_manifests[manifest_idx] = true;
+				loaded_manifests.push_back(manifest);
+			}
+			if (shared_state.manifest_cache) {
+				shared_state.manifest_cache->StoreManifests(loaded_manifests, context.metadata.iceberg_version);
 			}
 		}
 	}
@@ -204,6 +234,42 @@ void ClientSideScanPlanProvider::LoadManifestList() {
 	           DeleteManifests().size() + shared_state.transaction_delete_manifests.size());
 }
 
+bool ClientSideScanPlanProvider::TryRestoreCachedScanPlan() {
+	auto &scan_plan_cache = shared_state.scan_plan_cache;
+	if (!scan_plan_cache || !scan_plan_cache->Enabled()) {
+		return false;
+	}
+	if (context.transaction_data && !context.transaction_data->alters.empty()) {
+		//! The manifest list is (partially) made up by the transaction
+		return false;
+	}
+	shared_state.scan_plan_cache_key = IcebergScanPlanCache::GetKey(context.metadata, *context.snapshot.snapshot);
+	if (shared_state.scan_plan_cache_key.empty()) {
+		return false;
+	}
+	auto plan = scan_plan_cache->Take(shared_state.scan_plan_cache_key);
+	if (!plan) {
+		return false;
+	}
+
+	DataManifests() = std::move(plan->data_manifests);
+	shared_state.eagerly_loaded_data_manifests = std::move(plan->loaded_data_manifests);
+	DeleteManifests() = std::move(plan->delete_manifests);
+	{
+		annotated_lock_guard<annotated_mutex> delete_guard(shared_state.delete_lock);
+		shared_state.delete_file_loads = std::move(plan->delete_file_loads);
+		shared_state.positional_delete_data = std::move(plan->positional_delete_data);
+	}
+	idx_t loaded_data_manifest_count = 0;
+	for (auto loaded : shared_state.eagerly_loaded_data_manifests) {
+		loaded_data_manifest_count += loaded;
+	}
+	DUCKDB_LOG(shared_state.context, IcebergLogType,
+	           "Iceberg metadata phase=scan_plan_cache_hit loaded_data_manifests=%llu data_manifests=%llu",
+	           loaded_data_manifest_count, DataManifests().size());
+	return true;
+}
+
 void ClientSideScanPlanProvider::StartDataManifestScan(const vector<bool> &matching_manifests, idx_t filter_count) {
 	if (shared_state.data_manifest_scan_started) {
 		return;
@@ -211,11 +277,17 @@ void ClientSideScanPlanProvider::StartDataManifestScan(const vector<bool> &match
 	shared_state.data_manifest_scan_started = true;
 
 	const auto committed_manifest_count = DataManifests().size();
+	auto &manifest_cache = shared_state.manifest_cache;
 	vector<idx_t> selected_committed_manifests;
 	for (idx_t manifest_idx = 0; manifest_idx < committed_manifest_count; manifest_idx++) {
 		if (!matching_manifests[manifest_idx]) {
 			continue;
 		}
+		if (!shared_state.eagerly_loaded_data_manifests[manifest_idx] && manifest_cache &&
+		    manifest_cache->TryLoadManifest(DataManifests()[manifest_idx], context.metadata.iceberg_version)) {
+			//! Served from the manifest cache, the entries are available right away
+			shared_state.eagerly_loaded_data_manifests[manifest_idx] = true;
+		}
 		if (shared_state.eagerly_loaded_data_manifests[manifest_idx]) {
 			auto &manifest = DataManifests()[manifest_idx];
 			shared_state.read_state.PushBatch(
@@ -239,8 +311,9 @@ void ClientSideScanPlanProvider::StartDataManifestScan(const vector<bool> &match
 		auto data_scan = AvroScan::ScanManifest(context.snapshot, DataManifests(), context.options, context.fs,
 		                                        context.path, context.metadata, context.context,
 		                                        &shared_state.read_state, selected_committed_manifests);
-		shared_state.data_manifest_read_state =
-		    make_uniq<IcebergManifestScanningState>(shared_state.context, std::move(data_scan), DataManifests());
+		shared_state.data_manifest_read_state = make_uniq<IcebergManifestScanningState>(
+		    shared_state.context, std::move(data_scan), DataManifests(), &shared_state.read_state);
+		shared_state.scanned_data_manifests = selected_committed_manifests;
 
 		auto &executor = shared_state.data_manifest_read_state->executor;
 		auto &scheduler = TaskScheduler::GetScheduler(shared_state.context);
@@ -387,7 +460,7 @@ vector<IcebergDeleteFileReference> ClientSideScanPlanProvider::GetDeleteFiles(co
 					continue;
 				}
 				if (context.transaction_data &&
-				    context.transaction_data->IsFileInvalidated(manifest_entry.data_file.file_path)) {
+				    context.transaction_data->IsFileInvalidated(manifest_entry.data_file)) {
 					continue;
 				}
 				result.push_back({manifest_idx, entry_idx});
@@ -402,7 +475,7 @@ vector<IcebergDeleteFileReference> ClientSideScanPlanProvider::GetDeleteFiles(co
 					continue;
 				}
 				if (context.transaction_data &&
-				    context.transaction_data->IsFileInvalidated(manifest_entry.data_file.file_path)) {
+				    context.transaction_data->IsFileInvalidated(manifest_entry.data_file)) {
 					continue;
 				}
 				result.push_back({manifest_idx, entry_idx});
@@ -419,30 +492,53 @@ bool ClientSideScanPlanProvider::TryGetNextBatch(IcebergDataViewCursor &cursor)
 	if (!shared_state.data_manifest_read_state) {
 		return false;
 	}
+	//! The read tasks publish batches as they decode manifest entries, so the files of the first batch can be
+	//! scanned while the rest of the manifests are still being read
 	auto &scheduler = TaskScheduler::GetScheduler(shared_state.context);
 	auto &scan_state = *shared_state.data_manifest_read_state;
 	auto &executor = scan_state.executor;
+	auto scan_finished = [&]() {
+		return !scan_state.in_progress_tasks || executor.HasError();
+	};
 	shared_ptr<Task> task_to_execute;
-	while (scan_state.in_progress_tasks) {
+	while (!scan_finished()) {
 		if (executor.GetTask(task_to_execute)) {
+			//! Help out with a task that no thread has picked up yet
 			auto res = task_to_execute->Execute(TaskExecutionMode::PROCESS_PARTIAL);
 			if (res == TaskExecutionResult::TASK_NOT_FINISHED) {
 				auto &token = *task_to_execute->token;
 				scheduler.ScheduleTask(token, std::move(task_to_execute));
 			}
-			if (shared_state.read_state.TryReadBatch(cursor)) {
-				return true;
-			}
+			task_to_execute.reset();
+		} else {
+			//! Every task is running on another thread, wait for one of them to publish a batch. The timeout covers a
+			//! task that is being rescheduled, which we could pick up ourselves.
+			shared_state.read_state.WaitForBatch(cursor.next_batch_idx, scan_finished, std::chrono::milliseconds(10));
+		}
+		if (shared_state.read_state.TryReadBatch(cursor)) {
+			return true;
 		}
-		executor.WorkOnTasks();
-		break;
 	}
+	//! Once the scan failed or finished, FinishScanTasks surfaces its error
 	return shared_state.read_state.TryReadBatch(cursor);
 }
 
 void ClientSideScanPlanProvider::FinishScanTasks() {
-	if (shared_state.data_manifest_read_state) {
-		shared_state.data_manifest_read_state->executor.WorkOnTasks();
+	if (!shared_state.data_manifest_read_state) {
+		return;
+	}
+	shared_state.data_manifest_read_state->executor.WorkOnTasks();
+	if (shared_state.scanned_data_manifests.empty()) {
+		return;
+	}
+	vector<reference<const IcebergManifestListEntry>> loaded_manifests;
+	for (auto manifest_idx : shared_state.scanned_data_manifests) {
+		shared_state.eagerly_loaded_data_manifests[manifest_idx] = true;
+		loaded_manifests.push_back(DataManifests()[manifest_idx]);
+	}
+	shared_state.scanned_data_manifests.clear();
+	if (shared_state.manifest_cache) {
+		shared_state.manifest_cache->StoreManifests(loaded_manifests, context.metadata.iceberg_version);
 	}
 }
 
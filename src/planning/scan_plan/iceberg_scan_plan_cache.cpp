@@ -0,0 +1,127 @@
+#include "planning/scan_plan/iceberg_scan_plan_cache.hpp"
+
+#include "core/deletes/iceberg_deletion_vector.hpp"
+#include "core/deletes/iceberg_positional_delete.hpp"
+#include "core/metadata/iceberg_table_metadata.hpp"
+#include "core/metadata/snapshot/iceberg_snapshot.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+namespace {
+
+idx_t EstimateManifestSize(const IcebergManifestListEntry &manifest) {
+	idx_t result = sizeof(IcebergManifestListEntry) + manifest.file.manifest_path.size();
+	if (!manifest.HasManifestEntries()) {
+		return result;
+	}
+	auto &entries = manifest.GetManifestEntries();
+	result += entries.capacity() * sizeof(IcebergManifestEntry);
+	for (auto &entry : entries) {
+		auto &data_file = entry.data_file;
+		result += data_file.file_path.size();
+		result += data_file.partition_info.size() * sizeof(IcebergPartitionInfo);
+		//! Every field row holds a field id, the flags, four counts and two bounds
+		idx_t field_count = data_file.column_stats.FieldCount();
+		result += field_count * (sizeof(int32_t) + sizeof(uint8_t) + 4 * sizeof(int64_t) + 2 * sizeof(string_t));
+		for (idx_t row_idx = 0; row_idx < field_count; row_idx++) {
+			for (auto type : {IcebergColumnStatType::LOWER_BOUND, IcebergColumnStatType::UPPER_BOUND}) {
+				if (data_file.column_stats.RowHasStat(row_idx, type)) {
+					result += data_file.column_stats.RowBound(row_idx, type).GetSize();
+				}
+			}
+		}
+	}
+	return result;
+}
+
+idx_t EstimateBitmapsSize(const deletion_bitmap_map_t &bitmaps) {
+	idx_t result = 0;
+	for (auto &entry : bitmaps) {
+		result += sizeof(entry) + entry.second.getSizeInBytes(false);
+	}
+	return result;
+}
+
+} // namespace
+
+idx_t IcebergCachedScanPlan::EstimateMemorySize() const {
+	idx_t result = sizeof(IcebergCachedScanPlan);
+	for (auto &manifest : data_manifests) {
+		result += EstimateManifestSize(manifest);
+	}
+	for (auto &manifest : delete_manifests) {
+		result += EstimateManifestSize(manifest);
+	}
+	for (auto &entry : positional_delete_data) {
+		result += entry.first.size();
+		auto &delete_data = *entry.second;
+		switch (delete_data.type) {
+		case IcebergDeleteType::POSITIONAL_DELETE:
+			result += EstimateBitmapsSize(static_cast<const IcebergPositionalDeleteData &>(delete_data).bitmaps);
+			break;
+		case IcebergDeleteType::DELETION_VECTOR:
+			result += EstimateBitmapsSize(static_cast<const IcebergDeletionVectorData &>(delete_data).bitmaps);
+			break;
+		default:
+			throw InternalException("IcebergDeleteType %d not handled", static_cast<uint8_t>(delete_data.type));
+		}
+	}
+	return result;
+}
+
+IcebergScanPlanCache::IcebergScanPlanCache(idx_t max_memory) : max_memory(max_memory) {
+}
+
+string IcebergScanPlanCache::GetKey(const IcebergTableMetadata &metadata, const IcebergSnapshot &snapshot) {
+	if (metadata.table_uuid.empty() || !snapshot.snapshot_id) {
+		return string();
+	}
+	return StringUtil::Format("%s/%lld", metadata.table_uuid, *snapshot.snapshot_id);
+}
+
+void IcebergScanPlanCache::Erase(list<CacheEntry>::iterator it) {
+	memory_usage -= it->memory_size;
+	plan_map.erase(it->key);
+	plans.erase(it);
+}
+
+unique_ptr<IcebergCachedScanPlan> IcebergScanPlanCache::Take(const string &key) {
+	annotated_lock_guard<annotated_mutex> guard(lock);
+	auto it = plan_map.find(key);
+	if (it == plan_map.end()) {
+		return nullptr;
+	}
+	auto result = std::move(it->second->plan);
+	Erase(it->second);
+	return result;
+}
+
+void IcebergScanPlanCache::Put(const string &key, unique_ptr<IcebergCachedScanPlan> plan) {
+	auto memory_size = plan->EstimateMemorySize();
+	//! Destroy replaced and evicted plans outside of the lock
+	vector<unique_ptr<IcebergCachedScanPlan>> evicted_plans;
+	{
+		annotated_lock_guard<annotated_mutex> guard(lock);
+		auto existing = plan_map.find(key);
+		if (existing != plan_map.end()) {
+			evicted_plans.push_back(std::move(existing->second->plan));
+			Erase(existing->second);
+		}
+		if (memory_size > max_memory) {
+			//! The plan can never fit
+			evicted_plans.push_back(std::move(plan));
+			return;
+		}
+		while (!plans.empty() && memory_usage + memory_size > max_memory) {
+			auto last = std::prev(plans.end());
+			evicted_plans.push_back(std::move(last->plan));
+			Erase(last);
+		}
+		plans.push_front(CacheEntry {key, std::move(plan), memory_size});
+		plan_map[key] = plans.begin();
+		memory_usage += memory_size;
+	}
+}
+
+} // namespace duckdb
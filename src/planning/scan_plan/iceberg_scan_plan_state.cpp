@@ -1,10 +1,29 @@
 #include "planning/scan_plan/iceberg_scan_plan_state.hpp"
 
+#include "planning/scan_plan/iceberg_scan_plan_cache.hpp"
+
 namespace duckdb {
 
 void ManifestEntryReadState::PushBatch(ManifestReadBatch &&batch) {
-	lock_guard<mutex> guard(lock);
-	batches.push_back(std::move(batch));
+	{
+		lock_guard<mutex> guard(lock);
+		batches.push_back(std::move(batch));
+	}
+	batch_pushed.notify_all();
+}
+
+void ManifestEntryReadState::WaitForBatch(idx_t batch_idx, const std::function<bool()> &done,
+                                          std::chrono::milliseconds timeout) const {
+	unique_lock<mutex> guard(lock);
+	batch_pushed.wait_for(guard, timeout, [&]() { return batch_idx < batches.size() || done(); });
+}
+
+void ManifestEntryReadState::NotifyConsumers() const {
+	{
+		//! Taking the lock makes sure a consumer that just checked 'done' is waiting before it is woken up
+		lock_guard<mutex> guard(lock);
+	}
+	batch_pushed.notify_all();
 }
 
 bool ManifestEntryReadState::GetBatch(idx_t batch_idx, ManifestReadBatch &result) const {
@@ -23,16 +42,18 @@ bool ManifestEntryReadState::TryReadBatch(IcebergDataViewCursor &cursor) const {
 	cursor.next_batch_idx++;
 	cursor.current_batch_offset = cursor.current_batch.start_index;
 	cursor.has_current_batch = true;
+	cursor.current_batch_filtered = false;
 	return true;
 }
 
 IcebergScanPlanState::IcebergScanPlanState(ClientContext &context_p, shared_ptr<IcebergScanInfo> scan_info_p,
                                            string path_p, const IcebergOptions &options_p)
     : context(context_p), fs(FileSystem::GetFileSystem(context)), scan_info(std::move(scan_info_p)),
-      path(std::move(path_p)), options(options_p) {
+      path(std::move(path_p)), options(options_p), manifest_cache(IcebergManifestCache::TryCreate(context)) {
 }
 
 IcebergScanPlanState::~IcebergScanPlanState() {
+	bool data_manifest_scan_failed = false;
 	if (data_manifest_read_state) {
 		try {
 			data_manifest_read_state->executor.WorkOnTasks();
@@ -41,8 +62,51 @@ IcebergScanPlanState::~IcebergScanPlanState() {
 			//! noexcept (and this one can run while another exception is already unwinding), so letting the
 			//! error escape calls std::terminate and aborts the whole process. Errors are still surfaced on
 			//! the regular scan path (TryGetNextBatch/FinishScanTasks); here they can only be swallowed.
+			data_manifest_scan_failed = true;
+		}
+	}
+	if (data_manifest_scan_failed) {
+		//! The scanned manifests are only partially loaded
+		return;
+	}
+	try {
+		ReturnScanPlanToCache();
+	} catch (...) { // LCOV_EXCL_START
+		//! Caching the plan is best effort
+	} // LCOV_EXCL_STOP
+}
+
+void IcebergScanPlanState::ReturnScanPlanToCache() {
+	annotated_lock_guard<annotated_mutex> guard(lock);
+	annotated_lock_guard<annotated_mutex> delete_guard(delete_lock);
+	if (!scan_plan_cache || scan_plan_cache_key.empty()) {
+		return;
+	}
+	for (auto manifest_idx : scanned_data_manifests) {
+		eagerly_loaded_data_manifests[manifest_idx] = true;
+	}
+	//! The scan state references the data manifests
+	data_manifest_read_state.reset();
+
+	auto plan = make_uniq<IcebergCachedScanPlan>();
+	//! Moving the vectors keeps the manifest entries in place, so the references held by the delete data stay valid
+	plan->data_manifests = std::move(committed_data_manifests);
+	plan->loaded_data_manifests = std::move(eagerly_loaded_data_manifests);
+	plan->delete_manifests = std::move(committed_delete_manifests);
+	plan->delete_file_loads = std::move(delete_file_loads);
+	plan->delete_file_loads.resize(plan->delete_manifests.size());
+	for (auto &manifest_loads : plan->delete_file_loads) {
+		for (auto it = manifest_loads.begin(); it != manifest_loads.end();) {
+			auto &load = it->second;
+			if (!load || !load->complete || load->error.HasError()) {
+				it = manifest_loads.erase(it);
+			} else {
+				it++;
+			}
 		}
 	}
+	plan->positional_delete_data = std::move(positional_delete_data);
+	scan_plan_cache->Put(scan_plan_cache_key, std::move(plan));
 }
 
 } // namespace duckdb
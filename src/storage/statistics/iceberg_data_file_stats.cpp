@@ -2,6 +2,7 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/identifier.hpp"
+#include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/geometry.hpp"
 
@@ -15,7 +16,7 @@ namespace duckdb {
 
 namespace {
 
-static bool IsMapType(const string &col_name, IcebergTableSchema &table_schema) {
+static bool IsMapType(const string &col_name, const IcebergTableSchema &table_schema) {
 	for (auto &col : table_schema.columns) {
 		if (col->name == col_name) {
 			if (col->type.id() == LogicalTypeId::MAP) {
@@ -71,54 +72,66 @@ static vector<string> ParseQuotedList(const string &input, char list_separator)
 
 } // namespace
 
-void IcebergDataFileStats::PopulateFromReturnStats(ClientContext &context, IcebergDataFile &data_file,
-                                                   const Value &column_stats,
-                                                   const IcebergTableMetadata &table_metadata,
-                                                   const string &table_name) {
-	if (column_stats.IsNull()) {
-		return;
-	}
+IcebergDataFileStats::IcebergDataFileStats(ClientContext &context, const IcebergTableMetadata &table_metadata,
+                                           const string &table_name)
+    : context(context), table_metadata(table_metadata), table_name(table_name),
+      schema(*table_metadata.GetSchemas().at(table_metadata.GetCurrentSchemaId())),
+      default_metrics(GetDefaultMetricsConfig(table_metadata)) {
+}
 
-	auto table_current_schema_id = table_metadata.GetCurrentSchemaId();
-	auto &ic_schema = table_metadata.GetSchemas().at(table_current_schema_id);
-	auto &map_children = MapValue::GetChildren(column_stats);
+const IcebergDataFileStats::ResolvedColumn &IcebergDataFileStats::ResolveColumn(const string &column_name) {
+	auto entry = resolved_columns.find(column_name);
+	if (entry != resolved_columns.end()) {
+		return entry->second;
+	}
+	ResolvedColumn result;
+	result.column_names = ParseQuotedList(column_name, '.');
+	if (result.column_names[0] == "_row_id") {
+		result.skip = true;
+		return resolved_columns.emplace(column_name, std::move(result)).first->second;
+	}
+	result.column_info = schema.GetFromPath(StringsToIdentifiers(result.column_names), &result.name_offset);
+	if (!result.column_info) {
+		auto normalized_col_name = StringUtil::Join(result.column_names, ".");
+		throw InternalException("Column '%s' can not be found in the schema, but returned by RETURN_STATS",
+		                        normalized_col_name);
+	}
+	if (!result.name_offset.IsValid()) {
+		result.is_map = IsMapType(result.column_names[0], schema);
+		result.metrics =
+		    GetColumnMetricsConfig(table_metadata, default_metrics, StringUtil::Join(result.column_names, "."));
+	}
+	return resolved_columns.emplace(column_name, std::move(result)).first->second;
+}
 
+void IcebergDataFileStats::PopulateFromReturnStats(IcebergDataFile &data_file,
+                                                   const vector<IcebergReturnColumnStats> &column_stats) {
 	//! Variant columns emit one stats entry per shredded leaf — accumulate them
 	//! per variant column and serialize bounds once all entries are seen.
 	unordered_map<int32_t, IcebergVariantBounds> variant_bounds;
-	auto default_metrics = GetDefaultMetricsConfig(table_metadata);
-
-	for (idx_t col_idx = 0; col_idx < map_children.size(); col_idx++) {
-		auto &struct_children = StructValue::GetChildren(map_children[col_idx]);
-		auto &col_name = StringValue::Get(struct_children[0]);
-		auto &col_stats = MapValue::GetChildren(struct_children[1]);
-		auto column_names = ParseQuotedList(col_name, '.');
-		if (column_names[0] == "_row_id") {
-			continue;
-		}
 
-		optional_idx name_offset;
-		auto column_info_p = ic_schema->GetFromPath(StringsToIdentifiers(column_names), &name_offset);
-		if (!column_info_p) {
-			auto normalized_col_name = StringUtil::Join(column_names, ".");
-			throw InternalException("Column '%s' can not be found in the schema, but returned by RETURN_STATS",
-			                        normalized_col_name);
+	for (auto &returned_column : column_stats) {
+		auto &resolved = ResolveColumn(returned_column.column_name);
+		if (resolved.skip) {
+			continue;
 		}
-		if (name_offset.IsValid()) {
-			variant_bounds[column_info_p->id].AddStatsEntry(column_names, name_offset.GetIndex(), col_stats);
+		auto &column_names = resolved.column_names;
+		auto &col_stats = returned_column.stats;
+		if (resolved.name_offset.IsValid()) {
+			variant_bounds[resolved.column_info->id].AddStatsEntry(column_names, resolved.name_offset.GetIndex(),
+			                                                       col_stats);
 			continue;
 		}
-		auto &column_info = *column_info_p;
+		auto &column_info = *resolved.column_info;
 		auto stats = IcebergColumnStats::ParseColumnStats(column_info.type, col_stats, context);
 
 		//! Map types cannot violate NOT NULL; empty maps look like null maps.
-		bool is_map = IsMapType(column_names[0], *ic_schema);
-		if (!is_map && column_info.required && stats.null_count && *stats.null_count > 0) {
+		if (!resolved.is_map && column_info.required && stats.null_count && *stats.null_count > 0) {
 			auto normalized_col_name = StringUtil::Join(column_names, ".");
 			throw ConstraintException("NOT NULL constraint failed: %s.%s", table_name, normalized_col_name);
 		}
 
-		auto metrics = GetColumnMetricsConfig(table_metadata, default_metrics, StringUtil::Join(column_names, "."));
+		auto &metrics = resolved.metrics;
 		if (metrics.mode == IcebergMetricsMode::NONE) {
 			continue;
 		}
@@ -131,7 +144,8 @@ void IcebergDataFileStats::PopulateFromReturnStats(ClientContext &context, Icebe
 			if (serialized_value.HasError()) {
 				throw InvalidConfigurationException(serialized_value.GetError());
 			} else if (serialized_value.HasValue()) {
-				data_file.lower_bounds[column_info.id] = serialized_value.GetValue();
+				data_file.column_stats.SetBound(IcebergColumnStatType::LOWER_BOUND, column_info.id,
+				                                serialized_value.GetValue());
 			}
 		}
 		if (write_bounds && stats.max) {
@@ -140,7 +154,8 @@ void IcebergDataFileStats::PopulateFromReturnStats(ClientContext &context, Icebe
 			if (serialized_value.HasError()) {
 				throw InvalidConfigurationException(serialized_value.GetError());
 			} else if (serialized_value.HasValue()) {
-				data_file.upper_bounds[column_info.id] = serialized_value.GetValue();
+				data_file.column_stats.SetBound(IcebergColumnStatType::UPPER_BOUND, column_info.id,
+				                                serialized_value.GetValue());
 			}
 		}
 		//! Iceberg v3 Appendix D geometry bounding-box encoding.
@@ -163,24 +178,30 @@ void IcebergDataFileStats::PopulateFromReturnStats(ClientContext &context, Icebe
 				upper.push_back(stats.bbox_mmax);
 			}
 			const auto byte_count = lower.size() * sizeof(double);
-			data_file.lower_bounds[column_info.id] = Value::BLOB(const_data_ptr_cast<double>(lower.data()), byte_count);
-			data_file.upper_bounds[column_info.id] = Value::BLOB(const_data_ptr_cast<double>(upper.data()), byte_count);
+			auto &column_stats = data_file.column_stats;
+			column_stats.SetBound(IcebergColumnStatType::LOWER_BOUND, column_info.id,
+			                      Value::BLOB(const_data_ptr_cast<double>(lower.data()), byte_count));
+			column_stats.SetBound(IcebergColumnStatType::UPPER_BOUND, column_info.id,
+			                      Value::BLOB(const_data_ptr_cast<double>(upper.data()), byte_count));
 		}
 		if (stats.column_size_bytes) {
-			data_file.column_sizes[column_info.id] = *stats.column_size_bytes;
+			data_file.column_stats.SetCount(IcebergColumnStatType::COLUMN_SIZE, column_info.id,
+			                                NumericCast<int64_t>(*stats.column_size_bytes));
 		}
 		if (stats.null_count) {
-			data_file.null_value_counts[column_info.id] = *stats.null_count;
+			data_file.column_stats.SetCount(IcebergColumnStatType::NULL_VALUE_COUNT, column_info.id,
+			                                NumericCast<int64_t>(*stats.null_count));
 		}
 		if (stats.num_values) {
 			//! Iceberg value_counts includes nulls; Parquet num_values matches.
-			data_file.value_counts[column_info.id] = *stats.num_values;
+			data_file.column_stats.SetCount(IcebergColumnStatType::VALUE_COUNT, column_info.id,
+			                                NumericCast<int64_t>(*stats.num_values));
 		}
 	}
 
 	for (auto &entry : variant_bounds) {
 		auto variant_metrics =
-		    GetColumnMetricsConfig(table_metadata, default_metrics, GetColumnNameBySourceId(*ic_schema, entry.first));
+		    GetColumnMetricsConfig(table_metadata, default_metrics, GetColumnNameBySourceId(schema, entry.first));
 		if (variant_metrics.mode != IcebergMetricsMode::TRUNCATE && variant_metrics.mode != IcebergMetricsMode::FULL) {
 			continue;
 		}
@@ -190,10 +211,10 @@ void IcebergDataFileStats::PopulateFromReturnStats(ClientContext &context, Icebe
 			continue;
 		}
 		if (lower_blob) {
-			data_file.lower_bounds[entry.first] = Value::BLOB_RAW(*lower_blob);
+			data_file.column_stats.SetBound(IcebergColumnStatType::LOWER_BOUND, entry.first, string_t(*lower_blob));
 		}
 		if (upper_blob) {
-			data_file.upper_bounds[entry.first] = Value::BLOB_RAW(*upper_blob);
+			data_file.column_stats.SetBound(IcebergColumnStatType::UPPER_BOUND, entry.first, string_t(*upper_blob));
 		}
 	}
 }
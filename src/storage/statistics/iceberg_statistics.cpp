@@ -4,53 +4,53 @@
 
 namespace duckdb {
 
-IcebergColumnStats IcebergColumnStats::ParseColumnStats(const LogicalType &type, const vector<Value> &col_stats,
+IcebergColumnStats IcebergColumnStats::ParseColumnStats(const LogicalType &type,
+                                                        const vector<IcebergReturnStat> &col_stats,
                                                         ClientContext &context) {
 	IcebergColumnStats column_stats(type);
-	for (idx_t stats_idx = 0; stats_idx < col_stats.size(); stats_idx++) {
-		auto &stats_children = StructValue::GetChildren(col_stats[stats_idx]);
-		auto &stats_name = StringValue::Get(stats_children[0]);
+	for (auto &stat : col_stats) {
+		auto &stats_name = stat.name;
 		if (stats_name == "min") {
 			D_ASSERT(!column_stats.min);
-			column_stats.min = StringValue::Get(stats_children[1]);
+			column_stats.min = stat.value;
 		} else if (stats_name == "max") {
 			D_ASSERT(!column_stats.max);
-			column_stats.max = StringValue::Get(stats_children[1]);
+			column_stats.max = stat.value;
 		} else if (stats_name == "null_count") {
 			D_ASSERT(!column_stats.null_count);
-			column_stats.null_count = StringUtil::ToUnsigned(StringValue::Get(stats_children[1]));
+			column_stats.null_count = StringUtil::ToUnsigned(stat.value);
 		} else if (stats_name == "num_values") {
 			D_ASSERT(!column_stats.num_values);
-			column_stats.num_values = StringUtil::ToUnsigned(StringValue::Get(stats_children[1]));
+			column_stats.num_values = StringUtil::ToUnsigned(stat.value);
 		} else if (stats_name == "column_size_bytes") {
 			D_ASSERT(!column_stats.column_size_bytes);
-			column_stats.column_size_bytes = StringUtil::ToUnsigned(StringValue::Get(stats_children[1]));
+			column_stats.column_size_bytes = StringUtil::ToUnsigned(stat.value);
 		} else if (stats_name == "has_nan") {
 			D_ASSERT(!column_stats.contains_nan);
-			column_stats.contains_nan = StringValue::Get(stats_children[1]) == "true";
+			column_stats.contains_nan = stat.value == "true";
 		} else if (stats_name == "variant_type") {
 			//! Should be handled elsewhere
 			continue;
 		} else if (stats_name == "bbox_xmin") {
-			column_stats.bbox_xmin = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_xmin = std::stod(stat.value);
 		} else if (stats_name == "bbox_xmax") {
-			column_stats.bbox_xmax = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_xmax = std::stod(stat.value);
 		} else if (stats_name == "bbox_ymin") {
-			column_stats.bbox_ymin = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_ymin = std::stod(stat.value);
 			// xmin/xmax/ymin/ymax are always emitted together by the writer; flag XY
 			// once we've seen ymin to know we have at least the 2D bbox.
 			column_stats.has_bbox_xy = true;
 		} else if (stats_name == "bbox_ymax") {
-			column_stats.bbox_ymax = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_ymax = std::stod(stat.value);
 		} else if (stats_name == "bbox_zmin") {
-			column_stats.bbox_zmin = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_zmin = std::stod(stat.value);
 		} else if (stats_name == "bbox_zmax") {
-			column_stats.bbox_zmax = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_zmax = std::stod(stat.value);
 			column_stats.has_bbox_z = true;
 		} else if (stats_name == "bbox_mmin") {
-			column_stats.bbox_mmin = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_mmin = std::stod(stat.value);
 		} else if (stats_name == "bbox_mmax") {
-			column_stats.bbox_mmax = std::stod(StringValue::Get(stats_children[1]));
+			column_stats.bbox_mmax = std::stod(stat.value);
 			column_stats.has_bbox_m = true;
 		} else if (stats_name == "geo_types") {
 			// TODO: Iceberg has no standard manifest field for geometry type set
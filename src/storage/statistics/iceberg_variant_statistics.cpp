@@ -130,16 +130,15 @@ static optional<string> SerializeBoundsVariant(ClientContext &context, Value bou
 //===--------------------------------------------------------------------===//
 
 void IcebergVariantBounds::AddStatsEntry(const vector<string> &full_path, idx_t variant_field_start,
-                                         const vector<Value> &col_stats) {
+                                         const vector<IcebergReturnStat> &col_stats) {
 	D_ASSERT(variant_field_start < full_path.size());
 	auto &leaf = full_path.back();
 
 	// the "metadata" leaf carries the variant shredding type
 	if (full_path.size() == variant_field_start + 1 && leaf == "metadata") {
 		for (auto &stat : col_stats) {
-			auto &stat_children = StructValue::GetChildren(stat);
-			if (StringValue::Get(stat_children[0]) == "variant_type") {
-				variant_type_str = StringValue::Get(stat_children[1]);
+			if (stat.name == "variant_type") {
+				variant_type_str = stat.value;
 			}
 		}
 		return;
@@ -148,13 +147,12 @@ void IcebergVariantBounds::AddStatsEntry(const vector<string> &full_path, idx_t
 	// check leafs have values. That means path is not fully shredded
 	if (leaf == "value") {
 		optional<idx_t> null_count, num_values;
-		for (auto &child : col_stats) {
-			auto &child_children = StructValue::GetChildren(child);
-			if (StringValue::Get(child_children[0]) == "null_count") {
-				null_count = StringUtil::ToUnsigned(StringValue::Get(child_children[1]));
+		for (auto &stat : col_stats) {
+			if (stat.name == "null_count") {
+				null_count = StringUtil::ToUnsigned(stat.value);
 			}
-			if (StringValue::Get(child_children[0]) == "num_values") {
-				num_values = StringUtil::ToUnsigned(StringValue::Get(child_children[1]));
+			if (stat.name == "num_values") {
+				num_values = StringUtil::ToUnsigned(stat.value);
 			}
 		}
 		if (!num_values || !null_count || (*num_values - *null_count) > 0) {
@@ -170,12 +168,10 @@ void IcebergVariantBounds::AddStatsEntry(const vector<string> &full_path, idx_t
 	FieldBound bound;
 	bound.field_names = ExtractVariantFieldNames(full_path, variant_field_start);
 	for (auto &stat : col_stats) {
-		auto &stat_children = StructValue::GetChildren(stat);
-		auto &name = StringValue::Get(stat_children[0]);
-		if (name == "min") {
-			bound.min_value = StringValue::Get(stat_children[1]);
-		} else if (name == "max") {
-			bound.max_value = StringValue::Get(stat_children[1]);
+		if (stat.name == "min") {
+			bound.min_value = stat.value;
+		} else if (stat.name == "max") {
+			bound.max_value = stat.value;
 		}
 	}
 	if (bound.min_value || bound.max_value) {